@@ -0,0 +1,123 @@
+/* File: agents.c
+ * --------------
+ * This file implements the order-flow generator outlined in `agents.h`
+ */
+#include "agents.h"
+#ifdef HOSTED
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#define DEFAULT_MAX_QTY 100
+#define TREND_WEIGHT 0.1f       // weight of the newest return in a symbol's trend
+#define NOISE_SCATTER 0.01f     // spread of noise traders' limits around the price, as a fraction
+#define MAKER_SPREAD 0.002f     // makers quote at least this far off the price, as a fraction
+
+static const char *names[AGENT_KINDS] = { "noise", "momentum", "maker" };
+
+void agents_init(agents_t *gen, uint64_t seed, int nsymbols, agents_quote_fn quote, void *aux) {
+    prng_seed(&gen->rng, seed);
+    gen->nsymbols = (nsymbols < AGENTS_MAX_SYMBOLS ? nsymbols : AGENTS_MAX_SYMBOLS);
+    gen->quote = quote;
+    gen->aux = aux;
+    gen->n = 0;
+    gen->first_client = 0;
+    gen->max_qty = DEFAULT_MAX_QTY;
+    for (int i = 0; i < AGENTS_MAX_SYMBOLS; i++) {
+        gen->last[i] = 0;
+        gen->trend[i] = 0;
+    }
+}
+
+bool agents_populate(agents_t *gen, const int counts[AGENT_KINDS], int first_client) {
+    int n = 0;
+    for (int kind = 0; kind < AGENT_KINDS; kind++) {
+        if (counts[kind] < 0) return false;
+        n += counts[kind];
+    }
+    if (n > AGENTS_MAX) return false;
+    gen->n = 0;
+    for (int kind = 0; kind < AGENT_KINDS; kind++) {
+        for (int k = 0; k < counts[kind]; k++) {
+            gen->kinds[gen->n++] = kind;
+        }
+    }
+    gen->first_client = first_client;
+    return true;
+}
+
+int agents_count(const agents_t *gen, agent_kind_t kind) {
+    int n = 0;
+    for (int k = 0; k < gen->n; k++) {
+        if (gen->kinds[k] == kind) n++;
+    }
+    return n;
+}
+
+static price_t observe(agents_t *gen, int symbol) {
+    // Current price of `symbol`, folding its return since it was last seen into its trend
+    price_t price = gen->quote(symbol, gen->aux);
+    price_t last = gen->last[symbol];
+    if (last > 0 && price > 0) {
+        float ret = (float)(price - last) / last;
+        gen->trend[symbol] += TREND_WEIGHT * (ret - gen->trend[symbol]);
+    }
+    gen->last[symbol] = price;
+    return price;
+}
+
+static price_t offset(price_t price, float fraction) {
+    // `price` moved by `fraction` of itself, but never below a cent
+    price_t moved = (price_t)(price * (1 + fraction) + 0.5f);
+    return (moved > 0 ? moved : 1);
+}
+
+bool agents_next(agents_t *gen, agent_order_t *order) {
+    if (gen->n == 0 || gen->nsymbols == 0) return false;
+    int k = prng_range(&gen->rng, gen->n);
+    int symbol = prng_range(&gen->rng, gen->nsymbols);
+    price_t price = observe(gen, symbol);
+    *order = (agent_order_t){
+        .client = gen->first_client + k, .symbol = symbol,
+        .qty = 1 + prng_range(&gen->rng, gen->max_qty), .limit = BOOK_NO_PRICE,
+    };
+    switch (gen->kinds[k]) {
+    case AGENT_NOISE:
+        order->side = prng_range(&gen->rng, 2);
+        if (prng_range(&gen->rng, 2)) {
+            order->limit = offset(price, NOISE_SCATTER * prng_normal(&gen->rng));
+            order->bars = 1;
+        }
+        break;
+    case AGENT_MOMENTUM: {
+        float trend = gen->trend[symbol];
+        order->side = (trend > 0 ? SIDE_BUY : trend < 0 ? SIDE_SELL : prng_range(&gen->rng, 2));
+        order->ioc = true;
+        break;
+    }
+    case AGENT_MAKER: {
+        float spread = MAKER_SPREAD * (1 + prng_uniform(&gen->rng));
+        order->side = prng_range(&gen->rng, 2);
+        order->limit = offset(price, order->side == SIDE_BUY ? -spread : spread);
+        order->bars = 1;
+        break;
+    }
+    default:
+        return false;
+    }
+    return true;
+}
+
+int agents_format(const agent_order_t *order, const char *symbol, char *buf, size_t bufsize) {
+    char limit[16] = "", type[16] = "";
+    if (order->limit != BOOK_NO_PRICE) snprintf(limit, sizeof(limit), " %d.%02d", order->limit / 100, order->limit % 100);
+    if (order->bars > 0) snprintf(type, sizeof(type), " gtt %d", order->bars);
+    else if (order->ioc) snprintf(type, sizeof(type), " ioc");
+    return snprintf(buf, bufsize, "@%d %s %s %d%s%s", order->client, order->side == SIDE_BUY ? "buy" : "sell",
+                    symbol, order->qty, limit, type);
+}
+
+const char *agents_name(agent_kind_t kind) {
+    return (kind >= 0 && kind < AGENT_KINDS ? names[kind] : "?");
+}
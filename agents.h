@@ -0,0 +1,114 @@
+#ifndef AGENTS_H
+#define AGENTS_H
+
+/*
+ * Synthetic order flow from a population of simulated traders.
+ *
+ * Each agent trades for its own client account and follows one of three
+ * strategies:
+ *   noise     buys or sells at random, at market or with a limit scattered
+ *             around the price
+ *   momentum  trades at market in the direction the price has been moving
+ *   maker     quotes one side at a time just off the price, good for one bar
+ *
+ * Every order comes from one seeded PRNG stream, so a run is reproducible
+ * from its seed. The generator only reads prices (through a callback) and
+ * produces orders; formatted with `agents_format` they are ordinary
+ * command lines, so they enter the exchange exactly as typed commands do.
+ * The module has no board dependencies and builds hosted as well.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "book.h"
+#include "prng.h"
+
+#define AGENTS_MAX 16           // agents in a population
+#define AGENTS_MAX_SYMBOLS 32   // symbols the generator can trade
+
+typedef enum {
+    AGENT_NOISE = 0,
+    AGENT_MOMENTUM,
+    AGENT_MAKER,
+    AGENT_KINDS,
+} agent_kind_t;
+
+typedef struct {
+    int client;         // account the order is for
+    side_t side;
+    int symbol;
+    int qty;
+    price_t limit;      // BOOK_NO_PRICE for a market order
+    bool ioc;           // cancel whatever does not fill at once
+    int bars;           // if positive, good for this many bars only
+} agent_order_t;
+
+// Current price of `symbol` in cents
+typedef price_t (*agents_quote_fn)(int symbol, void *aux);
+
+typedef struct {
+    prng_t rng;
+    int nsymbols;
+    agents_quote_fn quote;
+    void *aux;
+    int n;                                  // agents in the population
+    agent_kind_t kinds[AGENTS_MAX];         // agent k trades for client `first_client + k`
+    int first_client;
+    int max_qty;                            // largest order, in shares
+    price_t last[AGENTS_MAX_SYMBOLS];       // price each symbol was last seen at
+    float trend[AGENTS_MAX_SYMBOLS];        // moving average of each symbol's returns
+} agents_t;
+
+/*
+ * `agents_init`
+ *
+ * Starts an empty population trading symbols 0 .. `nsymbols` - 1, priced
+ * by `quote`, with orders drawn from the stream of `seed`.
+ */
+void agents_init(agents_t *gen, uint64_t seed, int nsymbols, agents_quote_fn quote, void *aux);
+
+/*
+ * `agents_populate`
+ *
+ * Replaces the population with `counts[kind]` agents of each kind, which
+ * trade for consecutive clients from `first_client`.
+ *
+ * @return   false (and leaves the population unchanged) if that is more
+ *           than AGENTS_MAX agents
+ */
+bool agents_populate(agents_t *gen, const int counts[AGENT_KINDS], int first_client);
+
+/*
+ * `agents_count`
+ *
+ * @return   the number of agents of `kind` in the population
+ */
+int agents_count(const agents_t *gen, agent_kind_t kind);
+
+/*
+ * `agents_next`
+ *
+ * Draws the next order: a random agent decides on a random symbol.
+ *
+ * @return   false if the population is empty
+ */
+bool agents_next(agents_t *gen, agent_order_t *order);
+
+/*
+ * `agents_format`
+ *
+ * Writes `order` as the command line that places it, e.g.
+ * "@3 buy AAPL 100 172.50 gtt 1", naming its stock `symbol`.
+ *
+ * @return   the length of the line
+ */
+int agents_format(const agent_order_t *order, const char *symbol, char *buf, size_t bufsize);
+
+/*
+ * `agents_name`
+ *
+ * @return   the name of `kind` ("noise", "momentum" or "maker")
+ */
+const char *agents_name(agent_kind_t kind);
+
+#endif
@@ -0,0 +1,78 @@
+/* File: bench.c
+ * -------------
+ * This file implements the latency histogram outlined in `bench.h`
+ */
+#include "bench.h"
+#ifdef HOSTED
+#include <stdio.h>
+#else
+#include "printf.h"
+#endif
+
+#define SUB (1 << BENCH_SUB_BITS)
+
+uint64_t bench_cycles(void) {
+#if defined(__riscv)
+    uint64_t cycles;
+    // rdcycle, spelled as the CSR read it is (csrrs rd, cycle, x0) so it
+    // assembles under -march=rv64im, which lacks the Zicsr extension
+    __asm__ volatile (".insn i 0x73, 2, %0, x0, -1024" : "=r"(cycles));
+    return cycles;
+#elif defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static int bucket(uint64_t v) {
+    // values below SUB have a bucket each; above, the top BENCH_SUB_BITS
+    // bits after the leading one pick one of SUB buckets per power of two
+    if (v < SUB) return v;
+    int e = 63 - __builtin_clzll(v);
+    return ((e - BENCH_SUB_BITS + 1) << BENCH_SUB_BITS) + ((v >> (e - BENCH_SUB_BITS)) & (SUB - 1));
+}
+
+static uint64_t bucket_max(int b) {
+    // largest value that lands in bucket `b`
+    if (b < SUB) return b;
+    int e = (b >> BENCH_SUB_BITS) + BENCH_SUB_BITS - 1;
+    uint64_t low = (uint64_t)(SUB + (b & (SUB - 1))) << (e - BENCH_SUB_BITS);
+    return low + ((uint64_t)1 << (e - BENCH_SUB_BITS)) - 1;
+}
+
+void bench_reset(bench_t *bench) {
+    for (int b = 0; b < BENCH_BUCKETS; b++) {
+        bench->counts[b] = 0;
+    }
+    bench->n = bench->total = bench->max = 0;
+    bench->min = UINT64_MAX;
+}
+
+void bench_record(bench_t *bench, uint64_t cycles) {
+    bench->counts[bucket(cycles)]++;
+    bench->n++;
+    bench->total += cycles;
+    if (cycles < bench->min) bench->min = cycles;
+    if (cycles > bench->max) bench->max = cycles;
+}
+
+uint64_t bench_percentile(const bench_t *bench, int permille) {
+    if (bench->n == 0) return 0;
+    uint64_t rank = (bench->n * permille + 999) / 1000; // operations at or below the answer
+    if (rank == 0) rank = 1;
+    uint64_t seen = 0;
+    for (int b = 0; b < BENCH_BUCKETS; b++) {
+        seen += bench->counts[b];
+        if (seen >= rank) return (bucket_max(b) < bench->max ? bucket_max(b) : bench->max);
+    }
+    return bench->max;
+}
+
+int bench_format(const bench_t *bench, char *buf, size_t bufsize) {
+    if (bench->n == 0) return snprintf(buf, bufsize, "no operations recorded");
+    return snprintf(buf, bufsize, "cycles: min %ld p50 %ld p90 %ld p99 %ld p99.9 %ld max %ld mean %ld",
+                    (long)bench->min, (long)bench_percentile(bench, 500), (long)bench_percentile(bench, 900),
+                    (long)bench_percentile(bench, 990), (long)bench_percentile(bench, 999), (long)bench->max,
+                    (long)(bench->total / bench->n));
+}
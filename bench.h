@@ -0,0 +1,68 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/*
+ * Latency measurement for benchmarks.
+ *
+ * Per-operation costs, in CPU cycles, go into a log-linear histogram:
+ * each power of two is split into 16 buckets, so a recorded value is
+ * known to within about 6% however large it is. Recording is O(1) and
+ * the histogram has a fixed 4KB size, so the board can measure millions
+ * of operations without keeping them.
+ *
+ * Cycles are read from the `cycle` CSR on RISC-V and the time-stamp
+ * counter on x86 hosts.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_SUB_BITS 4
+#define BENCH_BUCKETS (64 << BENCH_SUB_BITS)
+
+typedef struct {
+    uint32_t counts[BENCH_BUCKETS];
+    uint64_t n, total, min, max;
+} bench_t;
+
+/*
+ * `bench_cycles`
+ *
+ * @return   the CPU cycle counter, or 0 where there is none
+ */
+uint64_t bench_cycles(void);
+
+/*
+ * `bench_reset`
+ *
+ * Empties `bench`.
+ */
+void bench_reset(bench_t *bench);
+
+/*
+ * `bench_record`
+ *
+ * Adds one operation that took `cycles` cycles.
+ */
+void bench_record(bench_t *bench, uint64_t cycles);
+
+/*
+ * `bench_percentile`
+ *
+ * @return   the cost that `permille` thousandths of the operations did not
+ *           exceed (500 for the median, 999 for the 99.9th percentile), to
+ *           within its bucket; 0 if nothing was recorded
+ */
+uint64_t bench_percentile(const bench_t *bench, int permille);
+
+/*
+ * `bench_format`
+ *
+ * Writes the distribution as one line of text: minimum, median, 90th,
+ * 99th and 99.9th percentile, maximum and mean cycles.
+ *
+ * @return   the length of the line
+ */
+int bench_format(const bench_t *bench, char *buf, size_t bufsize);
+
+#endif
@@ -0,0 +1,552 @@
+/* File: book.c
+ * ------------
+ * This file implements the order books and matching engine outlined in `book.h`
+ */
+#include "book.h"
+#include "malloc.h"
+
+#define NIL UINT32_MAX
+#define WORDS (BOOK_LEVELS / 64)
+#define SLOT_BITS 16             // BOOK_MAX_ORDERS == 1 << SLOT_BITS
+#define SLOT_MASK ((1u << SLOT_BITS) - 1)
+#define GEN_MASK 0x7fff          // generations wrap here, so no id is BOOK_NO_ORDER
+
+typedef struct {
+    uint32_t head, tail;  // oldest and newest order at this price
+    int32_t qty;          // total resting quantity
+} level_t;
+
+typedef struct {
+    level_t *levels;            // BOOK_LEVELS entries; level i is price i * tick
+    uint64_t occupied[WORDS];   // bit i set iff level i has orders
+    int best;                   // highest bid / lowest ask level, -1 if empty
+} side_book_t;
+
+typedef struct {
+    price_t tick;
+    side_book_t side[2];        // indexed by side_t
+} symbol_book_t;
+
+typedef struct {
+    uint32_t next, prev;        // FIFO links within the level, or free list link
+    uint32_t exp_next, exp_prev; // links within its expiry bucket
+    uint32_t acct_next, acct_prev; // links within its account's open orders
+    int32_t expiry;             // time passed to `book_expire` that cancels it, or BOOK_NO_EXPIRY
+    int32_t qty;
+    int32_t account;
+    uint16_t level;
+    uint16_t gen;               // bumped each time the slot is freed, retiring its old id
+    uint8_t symbol, side;
+    bool active;                // resting on a book
+} order_t;
+
+static struct {
+    int nsymbols;
+    fill_fn_t on_fill;
+    void *aux;
+    symbol_book_t books[BOOK_MAX_SYMBOLS];
+    order_t *orders;
+    uint32_t free_head;
+    uint32_t expiry_head[BOOK_EXPIRY_BUCKETS]; // orders expiring at time t are in bucket t % BOOK_EXPIRY_BUCKETS
+    uint32_t account_head[BOOK_MAX_ACCOUNTS];   // newest open order of each account
+    int account_count[BOOK_MAX_ACCOUNTS];
+    bool call;                  // call phase: orders rest without matching until `book_uncross`
+    int32_t *demand, *supply;   // BOOK_LEVELS each: cumulative quantities for `book_uncross`
+} module;
+
+// Bitmap helpers: find occupied levels a 64-level word at a time
+
+static void mark(side_book_t *sb, int level) {
+    sb->occupied[level >> 6] |= 1ULL << (level & 63);
+}
+
+static void unmark(side_book_t *sb, int level) {
+    sb->occupied[level >> 6] &= ~(1ULL << (level & 63));
+}
+
+static int next_up(const side_book_t *sb, int from) {
+    // lowest occupied level >= from, or -1
+    if (from >= BOOK_LEVELS) return -1;
+    int w = from >> 6;
+    uint64_t bits = sb->occupied[w] & (~0ULL << (from & 63));
+    while (bits == 0) {
+        if (++w == WORDS) return -1;
+        bits = sb->occupied[w];
+    }
+    return (w << 6) + __builtin_ctzll(bits);
+}
+
+static int next_down(const side_book_t *sb, int from) {
+    // highest occupied level <= from, or -1
+    if (from < 0) return -1;
+    int w = from >> 6;
+    uint64_t bits = sb->occupied[w] & (~0ULL >> (63 - (from & 63)));
+    while (bits == 0) {
+        if (--w < 0) return -1;
+        bits = sb->occupied[w];
+    }
+    return (w << 6) + 63 - __builtin_clzll(bits);
+}
+
+// Order pool
+
+// An order id is its pool slot plus the slot's generation, so an id
+// resolves to its order in O(1) and goes stale once the order is gone
+
+static uint32_t handle(uint32_t i) {
+    return ((uint32_t)module.orders[i].gen << SLOT_BITS) | i;
+}
+
+static bool resolve(uint32_t id, uint32_t *slot) {
+    uint32_t i = id & SLOT_MASK;
+    if (i >= BOOK_MAX_ORDERS || !module.orders[i].active || module.orders[i].gen != (id >> SLOT_BITS)) return false;
+    *slot = i;
+    return true;
+}
+
+static uint32_t order_alloc(void) {
+    uint32_t i = module.free_head;
+    if (i != NIL) module.free_head = module.orders[i].next;
+    return i;
+}
+
+static void expiry_unlink(uint32_t i) {
+    order_t *o = &module.orders[i];
+    if (o->expiry == BOOK_NO_EXPIRY) return;
+    uint32_t *head = &module.expiry_head[o->expiry % BOOK_EXPIRY_BUCKETS];
+    if (o->exp_prev != NIL) module.orders[o->exp_prev].exp_next = o->exp_next;
+    else *head = o->exp_next;
+    if (o->exp_next != NIL) module.orders[o->exp_next].exp_prev = o->exp_prev;
+    o->expiry = BOOK_NO_EXPIRY;
+}
+
+static void order_free(uint32_t i) {
+    module.orders[i].active = false;
+    module.orders[i].gen = (module.orders[i].gen + 1) & GEN_MASK;
+    module.orders[i].next = module.free_head;
+    module.free_head = i;
+}
+
+static void enqueue(uint32_t i) {
+    // appends resting order `i` to the back of its level
+    order_t *o = &module.orders[i];
+    side_book_t *sb = &module.books[o->symbol].side[o->side];
+    level_t *lv = &sb->levels[o->level];
+    o->next = NIL;
+    o->prev = lv->tail;
+    o->expiry = BOOK_NO_EXPIRY;
+    if (lv->tail != NIL) module.orders[lv->tail].next = i;
+    else lv->head = i;
+    lv->tail = i;
+    lv->qty += o->qty;
+    o->active = true;
+
+    uint32_t *head = &module.account_head[o->account];
+    o->acct_prev = NIL;
+    o->acct_next = *head;
+    if (*head != NIL) module.orders[*head].acct_prev = i;
+    *head = i;
+    module.account_count[o->account]++;
+
+    if (lv->head == i) { // level was empty
+        mark(sb, o->level);
+        bool better = (sb->best < 0) || (o->side == SIDE_BUY ? o->level > sb->best : o->level < sb->best);
+        if (better) sb->best = o->level;
+    }
+}
+
+static void dequeue(uint32_t i) {
+    // unlinks resting order `i` from its level, keeping `best` up to date
+    order_t *o = &module.orders[i];
+    side_book_t *sb = &module.books[o->symbol].side[o->side];
+    level_t *lv = &sb->levels[o->level];
+    if (o->prev != NIL) module.orders[o->prev].next = o->next;
+    else lv->head = o->next;
+    if (o->next != NIL) module.orders[o->next].prev = o->prev;
+    else lv->tail = o->prev;
+    lv->qty -= o->qty;
+    expiry_unlink(i);
+
+    if (o->acct_prev != NIL) module.orders[o->acct_prev].acct_next = o->acct_next;
+    else module.account_head[o->account] = o->acct_next;
+    if (o->acct_next != NIL) module.orders[o->acct_next].acct_prev = o->acct_prev;
+    module.account_count[o->account]--;
+
+    if (lv->head == NIL) { // level now empty
+        unmark(sb, o->level);
+        if (sb->best == o->level) {
+            sb->best = (o->side == SIDE_BUY ? next_down(sb, o->level) : next_up(sb, o->level));
+        }
+    }
+}
+
+static void take(uint32_t i, int q) {
+    // executes `q` shares of resting order `i`, removing it once it is filled
+    order_t *o = &module.orders[i];
+    if (q == o->qty) {
+        dequeue(i);
+        order_free(i);
+    } else {
+        o->qty -= q;
+        module.books[o->symbol].side[o->side].levels[o->level].qty -= q;
+    }
+}
+
+static int match(int symbol, side_t taker_side, int qty, int limit_level, uint32_t taker_id, int account, price_t taker_limit) {
+    // Executes up to `qty` against the opposite side at levels no worse than
+    // `limit_level`; returns the quantity executed
+    symbol_book_t *book = &module.books[symbol];
+    side_book_t *opp = &book->side[!taker_side];
+    int filled = 0;
+    while (qty > 0 && opp->best >= 0 && (taker_side == SIDE_BUY ? opp->best <= limit_level : opp->best >= limit_level)) {
+        uint32_t m = opp->levels[opp->best].head;
+        order_t *maker = &module.orders[m];
+        int q = (qty < maker->qty ? qty : maker->qty);
+        fill_t fill = {
+            .symbol = symbol, .taker_side = taker_side,
+            .price = opp->best * book->tick, .qty = q,
+            .maker_id = handle(m), .taker_id = taker_id,
+            .maker_account = maker->account, .taker_account = account,
+            .taker_limit = taker_limit,
+        };
+        take(m, q);
+        qty -= q;
+        filled += q;
+        module.on_fill(&fill, module.aux);
+    }
+    return filled;
+}
+
+static int limit_level(const symbol_book_t *book, side_t side, price_t limit) {
+    // buys round down to the tick, sells round up: never worse than asked
+    return side == SIDE_BUY ? limit / book->tick : (limit + book->tick - 1) / book->tick;
+}
+
+bool book_init(int nsymbols, const price_t max_price[], fill_fn_t on_fill, void *aux) {
+    module.nsymbols = nsymbols;
+    module.on_fill = on_fill;
+    module.aux = aux;
+    for (int s = 0; s < nsymbols; s++) {
+        symbol_book_t *book = &module.books[s];
+        book->tick = (2 * max_price[s] + BOOK_LEVELS - 1) / BOOK_LEVELS;
+        if (book->tick < 1) book->tick = 1;
+        for (int side = 0; side < 2; side++) {
+            side_book_t *sb = &book->side[side];
+            sb->levels = malloc(sizeof(level_t) * BOOK_LEVELS);
+            if (sb->levels == NULL) return false;
+            for (int i = 0; i < BOOK_LEVELS; i++) {
+                sb->levels[i] = (level_t){ NIL, NIL, 0 };
+            }
+            for (int w = 0; w < WORDS; w++) {
+                sb->occupied[w] = 0;
+            }
+            sb->best = -1;
+        }
+    }
+
+    module.orders = malloc(sizeof(order_t) * BOOK_MAX_ORDERS);
+    module.demand = malloc(sizeof(int32_t) * BOOK_LEVELS);
+    module.supply = malloc(sizeof(int32_t) * BOOK_LEVELS);
+    if (module.orders == NULL || module.demand == NULL || module.supply == NULL) return false;
+    module.call = false;
+    module.free_head = NIL;
+    for (uint32_t i = BOOK_MAX_ORDERS; i-- > 0; ) {
+        module.orders[i].gen = 0;
+        order_free(i);
+    }
+    for (int b = 0; b < BOOK_EXPIRY_BUCKETS; b++) {
+        module.expiry_head[b] = NIL;
+    }
+    for (int a = 0; a < BOOK_MAX_ACCOUNTS; a++) {
+        module.account_head[a] = NIL;
+        module.account_count[a] = 0;
+    }
+    return true;
+}
+
+price_t book_tick(int symbol) {
+    return module.books[symbol].tick;
+}
+
+bool book_submit(int symbol, side_t side, int qty, price_t limit, int account, bool rest, book_result_t *res) {
+    symbol_book_t *book = &module.books[symbol];
+    int level = limit_level(book, side, limit);
+    if (module.free_head == NIL) return false;
+    if (rest && (level < 0 || level >= BOOK_LEVELS || account < 0 || account >= BOOK_MAX_ACCOUNTS)) return false;
+
+    uint32_t i = order_alloc();
+    res->id = handle(i);
+    res->filled = (module.call ? 0 : match(symbol, side, qty, level, res->id, account, limit));
+    res->rested = rest && res->filled < qty;
+    if (res->rested) {
+        order_t *o = &module.orders[i];
+        o->qty = qty - res->filled;
+        o->account = account;
+        o->level = level;
+        o->symbol = symbol;
+        o->side = side;
+        enqueue(i);
+    } else {
+        order_free(i);
+    }
+    return true;
+}
+
+int book_sweep(int symbol, side_t taker_side, price_t limit, int account) {
+    symbol_book_t *book = &module.books[symbol];
+    side_book_t *opp = &book->side[!taker_side];
+    int level = limit_level(book, taker_side, limit);
+    if (opp->best < 0 || (taker_side == SIDE_BUY ? opp->best > level : opp->best < level)) {
+        return 0; // nothing crosses
+    }
+    return match(symbol, taker_side, INT32_MAX, level, BOOK_NO_ORDER, account, limit);
+}
+
+void book_set_call(bool call) {
+    module.call = call;
+}
+
+bool book_call(void) {
+    return module.call;
+}
+
+static int distance(int a, int b) {
+    return a > b ? a - b : b - a;
+}
+
+int book_uncross(int symbol, price_t reference, price_t *price) {
+    symbol_book_t *book = &module.books[symbol];
+    side_book_t *bids = &book->side[SIDE_BUY], *asks = &book->side[SIDE_SELL];
+    if (bids->best < 0 || asks->best < 0 || bids->best < asks->best) return 0; // not crossed
+
+    // only levels from the best ask up to the best bid can clear; demand at
+    // a level is every bid at or above it, supply every ask at or below it
+    int lo = asks->best, hi = bids->best;
+    int32_t total = 0;
+    for (int l = hi; l >= lo; l--) {
+        total += bids->levels[l].qty;
+        module.demand[l - lo] = total;
+    }
+    total = 0;
+    for (int l = lo; l <= hi; l++) {
+        total += asks->levels[l].qty;
+        module.supply[l - lo] = total;
+    }
+
+    // most volume, then least imbalance, then nearest the reference
+    int ref = reference / book->tick;
+    int best = lo, volume = 0, imbalance = 0;
+    for (int l = lo; l <= hi; l++) {
+        int32_t d = module.demand[l - lo], s = module.supply[l - lo];
+        int v = (d < s ? d : s);
+        if (v > volume || (v == volume && (distance(d, s) < imbalance || (distance(d, s) == imbalance && distance(l, ref) < distance(best, ref))))) {
+            best = l;
+            volume = v;
+            imbalance = distance(d, s);
+        }
+    }
+
+    // bids as takers and asks as makers, each side best price then oldest first
+    *price = best * book->tick;
+    for (int left = volume; left > 0; ) {
+        uint32_t b = bids->levels[bids->best].head, a = asks->levels[asks->best].head;
+        int q = module.orders[b].qty;
+        if (module.orders[a].qty < q) q = module.orders[a].qty;
+        if (left < q) q = left;
+        fill_t fill = {
+            .symbol = symbol, .taker_side = SIDE_BUY,
+            .price = *price, .qty = q,
+            .maker_id = handle(a), .taker_id = handle(b),
+            .maker_account = module.orders[a].account, .taker_account = module.orders[b].account,
+            .taker_limit = bids->best * book->tick,
+        };
+        take(a, q);
+        take(b, q);
+        left -= q;
+        module.on_fill(&fill, module.aux);
+    }
+    return volume;
+}
+
+static void describe(uint32_t i, book_order_t *out) {
+    const order_t *o = &module.orders[i];
+    *out = (book_order_t){
+        .symbol = o->symbol, .side = o->side,
+        .price = o->level * module.books[o->symbol].tick,
+        .qty = o->qty, .account = o->account, .expiry = o->expiry,
+    };
+}
+
+bool book_order(uint32_t id, book_order_t *out) {
+    uint32_t i;
+    if (!resolve(id, &i)) return false;
+    describe(i, out);
+    return true;
+}
+
+bool book_cancel(uint32_t id, book_order_t *out) {
+    uint32_t i;
+    if (!resolve(id, &i)) return false;
+    if (out) describe(i, out);
+    dequeue(i);
+    order_free(i);
+    return true;
+}
+
+bool book_reduce(uint32_t id, int qty) {
+    uint32_t i;
+    if (!resolve(id, &i)) return false;
+    order_t *o = &module.orders[i];
+    if (qty <= 0 || qty > o->qty) return false;
+    module.books[o->symbol].side[o->side].levels[o->level].qty -= o->qty - qty;
+    o->qty = qty; // stays where it is in the queue
+    return true;
+}
+
+bool book_set_expiry(uint32_t id, int when) {
+    uint32_t i;
+    if (!resolve(id, &i) || when < 0) return false;
+    expiry_unlink(i);
+    order_t *o = &module.orders[i];
+    uint32_t *head = &module.expiry_head[when % BOOK_EXPIRY_BUCKETS];
+    o->expiry = when;
+    o->exp_prev = NIL;
+    o->exp_next = *head;
+    if (*head != NIL) module.orders[*head].exp_prev = i;
+    *head = i;
+    return true;
+}
+
+int book_expire(int when, void (*on_cancel)(uint32_t id, const book_order_t *order)) {
+    int n = 0;
+    uint32_t i = module.expiry_head[when % BOOK_EXPIRY_BUCKETS];
+    while (i != NIL) {
+        uint32_t next = module.orders[i].exp_next; // cancelling unlinks `i`
+        if (module.orders[i].expiry == when) {
+            uint32_t id = handle(i);
+            book_order_t order;
+            book_cancel(id, &order);
+            if (on_cancel) on_cancel(id, &order);
+            n++;
+        }
+        i = next;
+    }
+    return n;
+}
+
+int book_cancel_all(int account, void (*on_cancel)(uint32_t id, const book_order_t *order)) {
+    int n = 0;
+    if (account < 0 || account >= BOOK_MAX_ACCOUNTS) return 0;
+    while (module.account_head[account] != NIL) {
+        uint32_t id = handle(module.account_head[account]);
+        book_order_t order;
+        book_cancel(id, &order);
+        if (on_cancel) on_cancel(id, &order);
+        n++;
+    }
+    return n;
+}
+
+int book_open_orders(int account, uint32_t ids[], int max) {
+    if (account < 0 || account >= BOOK_MAX_ACCOUNTS) return 0;
+    int n = 0;
+    for (uint32_t i = module.account_head[account]; i != NIL && n < max; i = module.orders[i].acct_next) {
+        ids[n++] = handle(i);
+    }
+    return n;
+}
+
+bool book_full(void) {
+    return module.free_head == NIL;
+}
+
+int book_open_count(int account) {
+    return (account < 0 || account >= BOOK_MAX_ACCOUNTS) ? 0 : module.account_count[account];
+}
+
+int book_export(book_order_t out[], uint32_t ids[], int max) {
+    // best level first and oldest first within a level, so resubmitting
+    // the orders in this order rebuilds every queue as it was
+    int n = 0;
+    for (int s = 0; s < module.nsymbols; s++) {
+        for (int side = 0; side < 2; side++) {
+            const side_book_t *sb = &module.books[s].side[side];
+            for (int level = sb->best; level >= 0; ) {
+                for (uint32_t i = sb->levels[level].head; i != NIL; i = module.orders[i].next) {
+                    if (n == max) return n;
+                    if (ids) ids[n] = handle(i);
+                    describe(i, &out[n++]);
+                }
+                level = (side == SIDE_BUY ? next_down(sb, level - 1) : next_up(sb, level + 1));
+            }
+        }
+    }
+    return n;
+}
+
+int book_load(const uint32_t ids[], const book_order_t orders[], int n) {
+    // empty every book, retiring the ids of whatever rested there
+    for (uint32_t i = 0; i < BOOK_MAX_ORDERS; i++) {
+        if (!module.orders[i].active) continue;
+        dequeue(i);
+        module.orders[i].active = false;
+        module.orders[i].gen = (module.orders[i].gen + 1) & GEN_MASK;
+    }
+    int loaded = 0;
+    for (int k = 0; k < n; k++) {
+        const book_order_t *src = &orders[k];
+        uint32_t i = ids[k] & SLOT_MASK;
+        if (src->symbol < 0 || src->symbol >= module.nsymbols || src->qty <= 0 || module.orders[i].active
+            || src->account < 0 || src->account >= BOOK_MAX_ACCOUNTS || (ids[k] >> SLOT_BITS) > GEN_MASK) continue;
+        int level = limit_level(&module.books[src->symbol], src->side, src->price);
+        if (level < 0 || level >= BOOK_LEVELS) continue;
+        order_t *o = &module.orders[i];
+        o->gen = ids[k] >> SLOT_BITS;
+        o->qty = src->qty;
+        o->account = src->account;
+        o->level = level;
+        o->symbol = src->symbol;
+        o->side = src->side;
+        enqueue(i);
+        if (src->expiry != BOOK_NO_EXPIRY) book_set_expiry(ids[k], src->expiry);
+        loaded++;
+    }
+    // the free list is every other slot, lowest first
+    module.free_head = NIL;
+    for (uint32_t i = BOOK_MAX_ORDERS; i-- > 0; ) {
+        if (module.orders[i].active) continue;
+        module.orders[i].next = module.free_head;
+        module.free_head = i;
+    }
+    return loaded;
+}
+
+price_t book_best(int symbol, side_t side) {
+    const symbol_book_t *book = &module.books[symbol];
+    int best = book->side[side].best;
+    return best < 0 ? BOOK_NO_PRICE : best * book->tick;
+}
+
+int book_available(int symbol, side_t side, int qty, price_t limit) {
+    const symbol_book_t *book = &module.books[symbol];
+    const side_book_t *opp = &book->side[!side];
+    int level = limit_level(book, side, limit), n = 0;
+    for (int l = opp->best; l >= 0 && n < qty; ) {
+        if (side == SIDE_BUY ? l > level : l < level) break;
+        n += opp->levels[l].qty;
+        l = (side == SIDE_BUY ? next_up(opp, l + 1) : next_down(opp, l - 1));
+    }
+    return n < qty ? n : qty;
+}
+
+int book_depth(int symbol, side_t side, price_t prices[], int qtys[], int max) {
+    const symbol_book_t *book = &module.books[symbol];
+    const side_book_t *sb = &book->side[side];
+    int n = 0;
+    for (int level = sb->best; level >= 0 && n < max; n++) {
+        prices[n] = level * book->tick;
+        qtys[n] = sb->levels[level].qty;
+        level = (side == SIDE_BUY ? next_down(sb, level - 1) : next_up(sb, level + 1));
+    }
+    return n;
+}
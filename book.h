@@ -0,0 +1,286 @@
+#ifndef BOOK_H
+#define BOOK_H
+
+/*
+ * Price-time priority limit order books and matching engine.
+ *
+ * Each symbol has a bid book and an ask book. A book is an array of price
+ * levels indexed by tick offset (level i holds orders at price i * tick),
+ * plus a bitmap of non-empty levels so the next best level is found a
+ * 64-level word at a time. Orders at a level form a FIFO queue threaded
+ * through a preallocated order pool by intrusive links, so adding and
+ * cancelling an order are O(1) and nothing is allocated after `book_init`.
+ *
+ * An order id packs the order's pool slot with a generation count for
+ * the slot, so looking an id up is O(1). The id goes stale as soon as the
+ * order leaves the book, even after the slot is reused.
+ *
+ * Every execution is reported through the fill callback given to
+ * `book_init`; the engine itself keeps no account balances.
+ *
+ * Trading is continuous except in a call phase: orders submitted then
+ * rest without matching, and `book_uncross` later executes everything
+ * that crosses at a single price.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BOOK_MAX_SYMBOLS 20
+#define BOOK_LEVELS 16384        // price levels per side per symbol
+#define BOOK_MAX_ORDERS 65536    // capacity of the order pool
+#define BOOK_MAX_ACCOUNTS 32     // accounts 0 .. BOOK_MAX_ACCOUNTS - 1 may rest orders
+#define BOOK_NO_ORDER UINT32_MAX
+#define BOOK_NO_PRICE (-1)
+#define BOOK_NO_EXPIRY (-1)
+#define BOOK_EXPIRY_BUCKETS 128  // expiry times are hashed into this many buckets
+
+typedef int32_t price_t; // price in cents
+
+typedef enum {
+    SIDE_BUY = 0,
+    SIDE_SELL = 1,
+} side_t;
+
+typedef struct {
+    int symbol;
+    side_t taker_side;      // side of the incoming (aggressive) order
+    price_t price;          // execution price: always the resting order's price
+    int qty;
+    uint32_t maker_id, taker_id;  // taker_id is BOOK_NO_ORDER for `book_sweep`
+    int maker_account, taker_account;
+    price_t taker_limit;    // limit price the taker was submitted with
+} fill_t;
+
+typedef void (*fill_fn_t)(const fill_t *fill, void *aux);
+
+typedef struct {
+    uint32_t id;    // id of the order; refers to a resting order only if `rested`
+    int filled;     // quantity executed immediately
+    bool rested;    // true if the remainder now rests on the book
+} book_result_t;
+
+typedef struct {
+    int symbol;
+    side_t side;
+    price_t price;
+    int qty;        // remaining quantity
+    int account;
+    int expiry;     // time set by `book_set_expiry`, or BOOK_NO_EXPIRY
+} book_order_t;
+
+/*
+ * `book_init`: Required initialization for module
+ *
+ * Allocates the books and order pool. The tick size of each symbol is the
+ * smallest whole number of cents that lets its book span prices up to
+ * twice `max_price[symbol]`.
+ *
+ * @param nsymbols    number of symbols, at most BOOK_MAX_SYMBOLS
+ * @param max_price   highest expected price of each symbol, in cents
+ * @param on_fill     called for every execution
+ * @param aux         passed through to `on_fill`
+ * @return            false if out of memory
+ */
+bool book_init(int nsymbols, const price_t max_price[], fill_fn_t on_fill, void *aux);
+
+/*
+ * `book_tick`
+ *
+ * @return   the tick size (price of one level) of `symbol`, in cents
+ */
+price_t book_tick(int symbol);
+
+/*
+ * `book_submit`
+ *
+ * Submits a limit order. It first executes against the opposite side at
+ * prices no worse than `limit`, best price first and oldest order first
+ * within a price. If `rest` is true, any remainder then joins the back of
+ * the queue at its limit price; otherwise the remainder is dropped.
+ * Resting buy limits are rounded down and sell limits up to the tick.
+ *
+ * @return   false if the order pool is full, or a remainder to rest is
+ *           priced outside the book or belongs to an account outside
+ *           0 .. BOOK_MAX_ACCOUNTS - 1; nothing executes in that case
+ */
+bool book_submit(int symbol, side_t side, int qty, price_t limit, int account, bool rest, book_result_t *res);
+
+/*
+ * `book_sweep`
+ *
+ * Executes an unlimited external counterparty (one not on the book)
+ * against every resting order on the side opposite `taker_side` priced no
+ * worse than `limit`. Costs O(1) when nothing crosses.
+ *
+ * @return   the total quantity executed
+ */
+int book_sweep(int symbol, side_t taker_side, price_t limit, int account);
+
+/*
+ * `book_set_call`
+ *
+ * Starts (`call` true) or ends a call phase for every symbol. While it
+ * lasts, `book_submit` executes nothing, so a book may be left crossed
+ * until `book_uncross`.
+ */
+void book_set_call(bool call);
+
+/*
+ * `book_call`
+ *
+ * @return   true during a call phase
+ */
+bool book_call(void);
+
+/*
+ * `book_uncross`
+ *
+ * Call auction: executes the crossed part of `symbol`'s book at the one
+ * price that matches the most volume. Ties go to the price with the
+ * least imbalance between demand and supply, then to the one nearest
+ * `reference`. The price is found from cumulative demand and supply over
+ * the crossed levels, in O(levels) no matter how many orders rest there.
+ * Resting bids execute as takers and asks as makers, best price first and
+ * then oldest first.
+ *
+ * @return   the volume executed; if positive, `price` is the clearing price
+ */
+int book_uncross(int symbol, price_t reference, price_t *price);
+
+/*
+ * `book_cancel`
+ *
+ * Removes resting order `id` from its book in O(1).
+ *
+ * @param out   if not NULL, receives the order as it was before the cancel
+ * @return      false if `id` is not a resting order
+ */
+bool book_cancel(uint32_t id, book_order_t *out);
+
+/*
+ * `book_reduce`
+ *
+ * Lowers the quantity of resting order `id` to `qty` in O(1) without
+ * moving it in its queue.
+ *
+ * @return   false if `id` is not a resting order or `qty` is not between
+ *           1 and its current quantity
+ */
+bool book_reduce(uint32_t id, int qty);
+
+/*
+ * `book_set_expiry`
+ *
+ * Schedules resting order `id` to be cancelled by `book_expire(when)`.
+ * The order joins the expiry bucket for `when` and leaves it in O(1)
+ * whenever it leaves the book, so expiring costs only the orders that
+ * share the bucket.
+ *
+ * @param when   any non-negative time, e.g. a bar index
+ * @return       false if `id` is not a resting order
+ */
+bool book_set_expiry(uint32_t id, int when);
+
+/*
+ * `book_expire`
+ *
+ * Cancels every resting order scheduled for `when`, calling `on_cancel`
+ * (if not NULL) with each one.
+ *
+ * @return   the number of orders cancelled
+ */
+int book_expire(int when, void (*on_cancel)(uint32_t id, const book_order_t *order));
+
+/*
+ * `book_cancel_all`
+ *
+ * Cancels every resting order of `account`, calling `on_cancel` (if not
+ * NULL) with each one. Each account's open orders are linked together,
+ * so this costs only that account's orders.
+ *
+ * @return   the number of orders cancelled
+ */
+int book_cancel_all(int account, void (*on_cancel)(uint32_t id, const book_order_t *order));
+
+/*
+ * `book_open_orders`
+ *
+ * Reports the ids of up to `max` resting orders of `account`, newest first.
+ *
+ * @return   the number of ids written to `ids`
+ */
+int book_open_orders(int account, uint32_t ids[], int max);
+
+/*
+ * `book_full`
+ *
+ * @return   true if the order pool has no free slot, so `book_submit`
+ *           would fail; an order that does not rest frees its slot again
+ */
+bool book_full(void);
+
+/*
+ * `book_open_count`
+ *
+ * @return   the number of resting orders of `account`, in O(1)
+ */
+int book_open_count(int account);
+
+/*
+ * `book_export`
+ *
+ * Copies up to `max` resting orders into `out`, ordered so that
+ * submitting them again with `book_submit` into empty books, or passing
+ * them to `book_load`, rebuilds every price level and queue position.
+ *
+ * @param ids   if not NULL, receives the id of each order
+ * @return      the number of orders written
+ */
+int book_export(book_order_t out[], uint32_t ids[], int max);
+
+/*
+ * `book_load`
+ *
+ * Replaces the contents of every book with `orders[0..n-1]`, each resting
+ * under its id from `ids`, queued in the order given. Used to restore
+ * books saved by `book_export` without renumbering their orders. Orders
+ * that cannot rest, or whose slot another order already took, are skipped.
+ *
+ * @return   the number of orders loaded
+ */
+int book_load(const uint32_t ids[], const book_order_t orders[], int n);
+
+/*
+ * `book_order`
+ *
+ * @return   true and fills `out` if `id` is a resting order, false otherwise
+ */
+bool book_order(uint32_t id, book_order_t *out);
+
+/*
+ * `book_best`
+ *
+ * @return   the best price on `side` of `symbol`, or BOOK_NO_PRICE if empty
+ */
+price_t book_best(int symbol, side_t side);
+
+/*
+ * `book_available`
+ *
+ * @return   how much of `qty` an order on `side` limited to `limit` would
+ *           execute against the book right now; walks only the levels it
+ *           would take
+ */
+int book_available(int symbol, side_t side, int qty, price_t limit);
+
+/*
+ * `book_depth`
+ *
+ * Reports up to `max` non-empty levels on `side`, best first.
+ *
+ * @return   number of levels written to `prices` and `qtys`
+ */
+int book_depth(int symbol, side_t side, price_t prices[], int qtys[], int max);
+
+#endif
@@ -0,0 +1,117 @@
+/* File: calendar.c
+ * ----------------
+ * This file implements the packed calendar outlined in `calendar.h`
+ */
+#include <stdbool.h>
+#include "calendar.h"
+
+#define MINUTES_PER_DAY 1440
+
+static const char *month_names = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+cal_t cal_make(int year, int month, int day, int minute) {
+    return (cal_t)year << 20 | (cal_t)month << 16 | (cal_t)day << 11 | (cal_t)minute;
+}
+
+int cal_year(cal_t c) {
+    return c >> 20;
+}
+
+int cal_month(cal_t c) {
+    return (c >> 16) & 0xf;
+}
+
+int cal_day(cal_t c) {
+    return (c >> 11) & 0x1f;
+}
+
+int cal_minute(cal_t c) {
+    return c & 0x7ff;
+}
+
+static bool is_leap(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int cal_days_in_month(int year, int month) {
+    static const unsigned char days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return days[month - 1] + (month == 2 && is_leap(year));
+}
+
+cal_t cal_add_months(cal_t c, int n) {
+    int months = cal_year(c) * 12 + (cal_month(c) - 1) + n;
+    int year = months / 12, month = months % 12 + 1;
+    int day = cal_day(c), last = cal_days_in_month(year, month);
+    return cal_make(year, month, day < last ? day : last, cal_minute(c));
+}
+
+cal_t cal_add_days(cal_t c, int n) {
+    int year = cal_year(c), month = cal_month(c), day = cal_day(c) + n;
+    while (day > cal_days_in_month(year, month)) {
+        day -= cal_days_in_month(year, month);
+        if (++month > 12) { month = 1; year++; }
+    }
+    while (day < 1) {
+        if (--month < 1) { month = 12; year--; }
+        day += cal_days_in_month(year, month);
+    }
+    return cal_make(year, month, day, cal_minute(c));
+}
+
+cal_t cal_add_minutes(cal_t c, int n) {
+    int minute = cal_minute(c) + n;
+    int days = minute / MINUTES_PER_DAY;
+    minute %= MINUTES_PER_DAY;
+    if (minute < 0) {
+        minute += MINUTES_PER_DAY;
+        days--;
+    }
+    c = cal_make(cal_year(c), cal_month(c), cal_day(c), minute);
+    return days ? cal_add_days(c, days) : c;
+}
+
+static char *put_digits(char *p, int val, int width) {
+    // writes `val` zero-padded to `width` digits; returns end of the digits
+    for (int i = width - 1; i >= 0; i--, val /= 10) {
+        p[i] = '0' + val % 10;
+    }
+    return p + width;
+}
+
+static char *put_month(char *p, int month) {
+    for (int i = 0; i < 3; i++) {
+        *p++ = month_names[3 * (month - 1) + i];
+    }
+    return p;
+}
+
+int cal_format(char *buf, size_t bufsize, cal_t c, cal_format_t fmt) {
+    char tmp[CAL_FORMAT_MAX], *p = tmp;
+    switch (fmt) {
+        case CAL_MONTH:
+            p = put_month(p, cal_month(c));
+            *p++ = ' ';
+            p = put_digits(p, cal_year(c), 4);
+            break;
+        case CAL_DAY:
+            p = put_digits(p, cal_day(c), 2);
+            *p++ = ' ';
+            p = put_month(p, cal_month(c));
+            *p++ = ' ';
+            p = put_digits(p, cal_year(c), 4);
+            break;
+        case CAL_TIME:
+            p = put_digits(p, cal_minute(c) / 60, 2);
+            *p++ = ':';
+            p = put_digits(p, cal_minute(c) % 60, 2);
+            break;
+    }
+    if (bufsize == 0) return 0;
+    int n = p - tmp;
+    if (n > (int)bufsize - 1) n = bufsize - 1;
+    for (int i = 0; i < n; i++) {
+        buf[i] = tmp[i];
+    }
+    buf[n] = '\0';
+    return n;
+}
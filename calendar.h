@@ -0,0 +1,73 @@
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+/*
+ * Compact calendar timestamps.
+ *
+ * A `cal_t` packs a date and a minute of the day into 32 bits:
+ *
+ *     bits 31..20  year   (0 - 4095)
+ *     bits 19..16  month  (1 - 12)
+ *     bits 15..11  day    (1 - 31)
+ *     bits 10..0   minute (0 - 1439, minutes since midnight)
+ *
+ * Packed timestamps compare in chronological order as plain integers,
+ * step with the arithmetic below, and format into a caller-supplied
+ * buffer without allocating, so a clock of any length needs no table of
+ * date strings.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t cal_t;
+
+typedef enum {
+    CAL_MONTH,   // "Dec 2015"
+    CAL_DAY,     // "03 Dec 2015"
+    CAL_TIME,    // "09:30"
+} cal_format_t;
+
+#define CAL_FORMAT_MAX 12 // buffer size that fits any format, including the terminator
+
+/*
+ * `cal_make`
+ *
+ * Packs a timestamp. Fields are not range-checked.
+ */
+cal_t cal_make(int year, int month, int day, int minute);
+
+int cal_year(cal_t c);
+int cal_month(cal_t c);
+int cal_day(cal_t c);
+int cal_minute(cal_t c);
+
+/*
+ * `cal_days_in_month`
+ *
+ * @return   number of days in `month` of `year`, accounting for leap years
+ */
+int cal_days_in_month(int year, int month);
+
+/*
+ * `cal_add_months`, `cal_add_days`, `cal_add_minutes`
+ *
+ * Return `c` moved forward (or back, for negative `n`) by `n` units,
+ * carrying into larger fields as needed. Adding months keeps the day,
+ * clamped to the length of the resulting month.
+ */
+cal_t cal_add_months(cal_t c, int n);
+cal_t cal_add_days(cal_t c, int n);
+cal_t cal_add_minutes(cal_t c, int n);
+
+/*
+ * `cal_format`
+ *
+ * Writes `c` into `buf` in format `fmt`, truncated to `bufsize` - 1
+ * characters and null-terminated.
+ *
+ * @return   the number of characters written (excluding the terminator)
+ */
+int cal_format(char *buf, size_t bufsize, cal_t c, cal_format_t fmt);
+
+#endif
@@ -0,0 +1,107 @@
+/* File: checkpoint.c
+ * ------------------
+ * This file implements the checkpoint storage outlined in `checkpoint.h`
+ */
+#include "checkpoint.h"
+#ifdef HOSTED
+#include <stdio.h>
+#include <string.h>
+#else
+#include "strings.h"
+#endif
+
+#define CHECKPOINT_MAGIC 0x4b4e5453 // "STNK"
+
+typedef struct {
+    uint32_t magic, version;
+    uint32_t size, seq;
+    uint32_t checksum;
+} header_t;
+
+static uint32_t fnv1a(const void *data, size_t size) {
+    const unsigned char *p = data;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+static bool valid(const header_t *hdr, const void *payload, size_t capacity, uint32_t version) {
+    return hdr->magic == CHECKPOINT_MAGIC && hdr->version == version && hdr->size <= capacity
+        && hdr->checksum == fnv1a(payload, hdr->size);
+}
+
+#ifdef HOSTED
+
+// Hosted build: one file, replaced atomically by writing a temporary and renaming it
+
+bool checkpoint_save(const void *state, size_t size, uint32_t version) {
+    header_t hdr = { CHECKPOINT_MAGIC, version, size, 0, fnv1a(state, size) };
+    FILE *fp = fopen(CHECKPOINT_FILE ".tmp", "wb");
+    if (fp == NULL) return false;
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1 && fwrite(state, size, 1, fp) == 1;
+    ok = (fclose(fp) == 0) && ok;
+    return ok && rename(CHECKPOINT_FILE ".tmp", CHECKPOINT_FILE) == 0;
+}
+
+bool checkpoint_restore(void *state, size_t capacity, uint32_t version) {
+    FILE *fp = fopen(CHECKPOINT_FILE, "rb");
+    if (fp == NULL) return false;
+    header_t hdr;
+    bool ok = fread(&hdr, sizeof(hdr), 1, fp) == 1 && hdr.size <= capacity && fread(state, hdr.size, 1, fp) == 1;
+    fclose(fp);
+    return ok && valid(&hdr, state, capacity, version);
+}
+
+void checkpoint_clear(void) {
+    remove(CHECKPOINT_FILE);
+}
+
+#else
+
+// Board: two slots in reserved DRAM; the valid slot with the higher sequence number wins
+
+static header_t *slot(int k) {
+    return (header_t *)(uintptr_t)(CHECKPOINT_ADDR + k * CHECKPOINT_SLOT_SIZE);
+}
+
+static int newest(uint32_t version) {
+    // Returns index of the newest valid slot, or -1 if none
+    int best = -1;
+    for (int k = 0; k < 2; k++) {
+        header_t *hdr = slot(k);
+        if (!valid(hdr, hdr + 1, CHECKPOINT_SLOT_SIZE - sizeof(header_t), version)) continue;
+        if (best < 0 || (int32_t)(hdr->seq - slot(best)->seq) > 0) best = k;
+    }
+    return best;
+}
+
+bool checkpoint_save(const void *state, size_t size, uint32_t version) {
+    if (size > CHECKPOINT_SLOT_SIZE - sizeof(header_t)) return false;
+    int cur = newest(version);
+    int k = (cur == 0 ? 1 : 0); // never overwrite the newest good checkpoint
+    header_t *hdr = slot(k);
+    hdr->magic = 0; // invalidate first so a torn write is never accepted
+    memcpy(hdr + 1, state, size);
+    hdr->version = version;
+    hdr->size = size;
+    hdr->seq = (cur < 0 ? 1 : slot(cur)->seq + 1);
+    hdr->checksum = fnv1a(state, size);
+    hdr->magic = CHECKPOINT_MAGIC;
+    return true;
+}
+
+bool checkpoint_restore(void *state, size_t capacity, uint32_t version) {
+    int k = newest(version);
+    if (k < 0 || slot(k)->size > capacity) return false;
+    memcpy(state, slot(k) + 1, slot(k)->size);
+    return true;
+}
+
+void checkpoint_clear(void) {
+    slot(0)->magic = 0;
+    slot(1)->magic = 0;
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+/*
+ * Checkpoint storage for exchange state.
+ *
+ * A checkpoint is an opaque blob of caller-defined state, stored with a
+ * header (magic, layout version, size, sequence number, checksum) so that
+ * a torn or stale checkpoint is rejected on restore instead of loaded.
+ *
+ * On the board, checkpoints live in a reserved region of DRAM outside the
+ * program image and heap, which survives a warm reboot (`reboot`) but not
+ * a power cycle. Two slots are written alternately, so an interrupted
+ * save never destroys the previous good checkpoint. A hosted build
+ * (compiled with -DHOSTED) writes to the file CHECKPOINT_FILE instead.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef CHECKPOINT_ADDR
+#define CHECKPOINT_ADDR 0x5fe00000 // 2MB reserved well above the stack top (0x50000000)
+#endif
+#define CHECKPOINT_SLOT_SIZE 0x100000
+#ifndef CHECKPOINT_FILE
+#define CHECKPOINT_FILE "exchange.ckpt"
+#endif
+
+/*
+ * `checkpoint_save`
+ *
+ * Stores `size` bytes of `state` as the newest checkpoint.
+ *
+ * @param state     the state to save
+ * @param size      its size in bytes (at most one slot minus the header)
+ * @param version   layout version of `state`; bump it whenever the layout changes
+ * @return          true on success, false if too large or the write failed
+ */
+bool checkpoint_save(const void *state, size_t size, uint32_t version);
+
+/*
+ * `checkpoint_restore`
+ *
+ * Copies the newest valid checkpoint into `state`. A checkpoint is valid
+ * only if its magic, version and checksum match. Checkpoints may be
+ * shorter than `capacity`, so variable-length state must record its own
+ * length.
+ *
+ * @param capacity   size of `state` in bytes; longer checkpoints are rejected
+ * @return           true if `state` was filled in, false if there is no valid checkpoint
+ */
+bool checkpoint_restore(void *state, size_t capacity, uint32_t version);
+
+/*
+ * `checkpoint_clear`
+ *
+ * Invalidates all stored checkpoints.
+ */
+void checkpoint_clear(void);
+
+#endif
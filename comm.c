@@ -14,76 +14,178 @@
 #include "printf.h"
 #include "ringbuffer.h"
 #include "interface.h"
+#include "strings.h"
+#include "ring.h"
+#include "hstimer.h"
+
+#define COMM_RX_SIZE 4096 // bytes received and not yet framed; a power of two
+#define COMM_TX_SIZE 16384 // bytes queued for sending; a power of two
+#define COMM_TX_USECS 100 // period of the send timer, which sends one byte; about the line rate at 115200 baud
+#define COMM_LINE_MAX 1024
+
+// Received bytes pass from the UART interrupt to the main loop, and
+// replies from the engine to the send timer's interrupt, through lock-free
+// rings; the interrupt handlers do nothing but move bytes
+static struct {
+    ring_t rx, tx;
+    uint8_t rx_bytes[COMM_RX_SIZE], tx_bytes[COMM_TX_SIZE];
+    bool quiet;
+    bool evaluating; // a command is running in the main loop, which may wait for `tx` to drain
+    int rx_dropped, tx_dropped; // bytes lost to a full `rx`, replies lost to a full `tx`
+    int rx_reported, tx_reported; // drops already reported to the client
+    // framing of received commands, `###<command>###`
+    int hash_count;
+    bool collecting;
+    char line[COMM_LINE_MAX];
+    int len;
+} module;
 
 void comm_init(void) {
     uart_init();
     static bool initialized = false;
     if (initialized) error("comm_init() should be called only once.");
     initialized = true;
+    ring_init(&module.rx, module.rx_bytes, COMM_RX_SIZE, 1);
+    ring_init(&module.tx, module.tx_bytes, COMM_TX_SIZE, 1);
     uart_putstring("\n\n\n\n");
 }
 
-int comm_putstring(const char *str) {
-    int n = 0;
-    uart_putchar('#');
-    uart_putchar('#');
-    uart_putchar('#');
-
-    while (str[n]) {
-        for (int i = 0; i < 1000000; i++) {};
-        uart_putchar(str[n++]);
+void comm_set_quiet(bool on) {
+    module.quiet = on;
+}
+
+static void drain(int n) {
+    // Sends queued bytes directly until `tx` has room for `n`. Only for
+    // the main loop with interrupts off, when the send timer cannot run.
+    unsigned char ch;
+    while (ring_space(&module.tx) < n && ring_pop(&module.tx, &ch)) {
+        uart_putchar(ch);
+    }
+}
+
+static bool queue(const char *str, int n) {
+    // queued whole or not at all, so a full ring never tears the framing
+    if (module.evaluating) drain(n + 6);
+    if (ring_space(&module.tx) < n + 6) return false;
+    ring_push(&module.tx, "###", 3);
+    ring_push(&module.tx, str, n);
+    ring_push(&module.tx, "###", 3);
+    return true;
+}
+
+static void report_drops(void) {
+    // Tells the client about input and replies lost since it was last told
+    char buf[100];
+    if (module.rx_dropped == module.rx_reported && module.tx_dropped == module.tx_reported) return;
+    snprintf(buf, sizeof(buf), "\nwarning: output truncated; %d replies and %d input bytes dropped\n",
+             module.tx_dropped - module.tx_reported, module.rx_dropped - module.rx_reported);
+    if (queue(buf, strlen(buf))) {
+        module.rx_reported = module.rx_dropped;
+        module.tx_reported = module.tx_dropped;
     }
-    uart_putchar('#');
-    uart_putchar('#');
-    uart_putchar('#');
+}
 
+int comm_putstring(const char *str) {
+    // Queues `str` framed by ### for the send timer. Replies come from
+    // interrupt handlers and from the main loop with interrupts off, so
+    // pushes never interleave and the ring has a single producer. A command
+    // waits for room; an interrupt handler cannot, so its reply is dropped
+    // and the drop reported with the next reply that fits.
+    if (module.quiet) return 0;
+    report_drops();
+    int n = strlen(str);
+    if (!queue(str, n)) {
+        module.tx_dropped++;
+        return -1;
+    }
     return n;
 }
 
-void uart_rx_interrupt_handler(long unsigned int irq, void *client_data) {
-    static int hash_count = 0;
-    static bool collecting = false;
-    static char message_buffer[1024];
-    static int message_index = 0;
+static void evaluate(char *line) {
+    // Runs a received command for the terminal its tag names: the
+    // multiplexer that shares the port between terminals frames each line
+    // as `###<terminal>|<command>###`; untagged lines come from the console,
+    // and a tagged terminal 0 is an ordinary terminal like the rest
+    int terminal = EXCHANGE_CONSOLE;
+    char *bar = line;
+    while (*bar >= '0' && *bar <= '9') bar++;
+    if (*bar == '|' && bar != line) {
+        const char *end;
+        unsigned long id = strtonum(line, &end);
+        terminal = (id > INT32_MAX ? INT32_MAX : (int)id); // an out of range id must not wrap to the console
+        line = bar + 1;
+    }
+    interrupts_global_disable(); // the engine runs one command or tick at a time
+    module.evaluating = true;
+    exchange_evaluate(terminal, line);
+    module.evaluating = false;
+    interrupts_global_enable();
+}
 
-    while (uart_haschar()) {
-        unsigned char ch = uart_recv();
-        
-        if (!collecting) {
-            if (ch == '#') {
-                hash_count++;
-                if (hash_count == 3) {
-                    collecting = true;
-                    message_index = 0; 
-                }
-            } else {
-                hash_count = 0;
+static void frame(unsigned char ch) {
+    // Collects the command between ### markers and evaluates it once complete
+    if (!module.collecting) {
+        if (ch == '#') {
+            module.hash_count++;
+            if (module.hash_count == 3) {
+                module.collecting = true;
+                module.len = 0;
+            }
+        } else {
+            module.hash_count = 0;
+        }
+    } else {
+        if (ch == '#') {
+            module.hash_count++;
+            if (module.hash_count == 3) {
+                module.line[module.len] = '\0';
+                evaluate(module.line);
+
+                module.collecting = false;
+                module.hash_count = 0;
+                module.len = 0;
             }
         } else {
-            if (ch == '#') {
-                hash_count++;
-                if (hash_count == 3) {
-                    message_buffer[message_index] = '\0';
-                    // comm_putstring(message_buffer);
-                    exchange_evaluate(message_buffer); 
-
-                    collecting = false;
-                    hash_count = 0;
-                    message_index = 0; 
-                }
-            } else {
-                if (message_index < sizeof(message_buffer) - 1) { 
-                    message_buffer[message_index++] = ch;
-                }
-                hash_count = 0;
+            if (module.len < sizeof(module.line) - 1) {
+                module.line[module.len++] = ch;
             }
+            module.hash_count = 0;
         }
     }
 }
 
+void comm_service(void) {
+    // Consumer of `rx`: evaluates every command received so far
+    unsigned char ch;
+    while (ring_pop(&module.rx, &ch)) {
+        frame(ch);
+    }
+    if (module.rx_dropped != module.rx_reported) {
+        interrupts_global_disable();
+        report_drops();
+        interrupts_global_enable();
+    }
+}
+
+static void tx_interrupt_handler(uintptr_t pc, void *client_data) {
+    // Consumer of `tx`: sends one queued byte per timer period
+    hstimer_interrupt_clear(HSTIMER1);
+    unsigned char ch;
+    if (ring_pop(&module.tx, &ch)) uart_putchar(ch);
+}
 
+void uart_rx_interrupt_handler(long unsigned int irq, void *client_data) {
+    // Producer of `rx`: moves received bytes into the ring and nothing else
+    while (uart_haschar()) {
+        unsigned char ch = uart_recv();
+        if (!ring_push(&module.rx, &ch, 1)) module.rx_dropped++;
+    }
+}
 
 void setup_uart_interrupts() {
     uart_use_interrupts(uart_rx_interrupt_handler, NULL);
-    
+    hstimer_init(HSTIMER1, COMM_TX_USECS);
+    hstimer_enable(HSTIMER1);
+    interrupts_enable_source(INTERRUPT_SOURCE_HSTIMER1);
+    interrupts_register_handler(INTERRUPT_SOURCE_HSTIMER1, tx_interrupt_handler, NULL);
 }
@@ -58,14 +58,39 @@ bool comm_haschar(void);
 /*
  * `comm_putstring`
  *
- * Outputs a string to the serial port by calling `comm_putchar`
- * on each character.
+ * Queues a string, framed by ###, to be sent on the serial port by the
+ * send timer's interrupt. The whole string is queued or none of it. A
+ * command run by `comm_service` waits for room in the send ring; from an
+ * interrupt handler a string that does not fit is dropped, and the next
+ * one that fits is preceded by a warning that counts the drops. Callers
+ * must run in an interrupt handler or with interrupts disabled, so the
+ * send ring has one producer at a time.
  *
  * @param str  the string to output
  * @return     the count of characters written or EOF if error
  */
 int comm_putstring(const char *str);
 
+/*
+ * `comm_service`
+ *
+ * Main loop side of the serial port: evaluates every complete command
+ * received so far, with interrupts disabled while each runs. Call it
+ * often; the UART interrupt only moves received bytes into a ring, and a
+ * timer interrupt paces queued output onto the wire.
+ */
+void comm_service(void);
+
+/*
+ * `comm_set_quiet`
+ *
+ * While `quiet` is true, `comm_putstring` discards its string and
+ * returns 0. Used to mute replies to generated load.
+ *
+ * @param quiet  whether output is muted
+ */
+void comm_set_quiet(bool quiet);
+
 /*
  * `comm_send`
  *
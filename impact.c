@@ -0,0 +1,54 @@
+/* File: impact.c
+ * --------------
+ * This file implements the market impact model outlined in `impact.h`
+ */
+#include "impact.h"
+#include "mathlib.h"
+
+#define IMPACT_EPSILON 1e-5f // displacements smaller than this snap back to the path
+
+static float move(const impact_params_t *params, long notional) {
+    // Displacement caused by a trade of `notional` cents
+    if (params->model == IMPACT_OFF || params->depth <= 0) return 0;
+    float participation = notional / params->depth;
+    float m = params->coeff * (params->model == IMPACT_SQRT ? sqrt(participation) : participation);
+    return m < IMPACT_MAX ? m : IMPACT_MAX;
+}
+
+void impact_set_halflife(impact_params_t *params, int ticks) {
+    params->halflife = ticks;
+    params->decay = (ticks > 0 ? pow(0.5f, 1.0f / ticks) : 0);
+}
+
+float impact_price(const impact_t *impact, float path) {
+    return path * (1 + impact->offset);
+}
+
+static void clamp(impact_t *impact) {
+    if (impact->offset > IMPACT_MAX) impact->offset = IMPACT_MAX;
+    if (impact->offset < -IMPACT_MAX) impact->offset = -IMPACT_MAX;
+}
+
+void impact_set_price(impact_t *impact, float path, float price) {
+    if (path <= 0) return;
+    impact->offset = price / path - 1;
+    clamp(impact);
+}
+
+float impact_slippage(const impact_params_t *params, long notional) {
+    // mean of the displacement over the trade: the integral of m(q) dq / q
+    return move(params, notional) * (params->model == IMPACT_SQRT ? 2.0f / 3 : 0.5f);
+}
+
+void impact_trade(impact_t *impact, const impact_params_t *params, side_t side, long notional) {
+    float m = move(params, notional);
+    impact->offset += (side == SIDE_BUY ? m : -m);
+    clamp(impact);
+}
+
+bool impact_decay(impact_t *impact, const impact_params_t *params) {
+    if (impact->offset == 0) return false;
+    impact->offset *= params->decay;
+    if (fabs(impact->offset) < IMPACT_EPSILON) impact->offset = 0;
+    return true;
+}
@@ -0,0 +1,88 @@
+#ifndef IMPACT_H
+#define IMPACT_H
+
+/*
+ * Market impact of order flow.
+ *
+ * Each stock keeps a displacement of its live price from the historical
+ * path, as a fraction of the path price. Every trade pushes the
+ * displacement in its direction by an amount that grows with the trade's
+ * notional as a share of the market's depth: linearly, or as its square
+ * root (the usual empirical law, under which doubling a trade less than
+ * doubles its impact). Between trades the displacement decays
+ * geometrically back toward the path. Both updates are O(1) per stock.
+ */
+
+#include <stdbool.h>
+#include "book.h"
+
+#define IMPACT_MAX 0.5f // largest displacement, either way
+
+typedef enum {
+    IMPACT_OFF = 0,
+    IMPACT_LINEAR,
+    IMPACT_SQRT,
+} impact_model_t;
+
+typedef struct {
+    impact_model_t model;
+    float coeff;        // displacement caused by a trade of the full depth
+    float depth;        // cents of notional that count as the full depth
+    float decay;        // share of the displacement left after each tick
+    int halflife;       // ticks over which `decay` halves a displacement
+} impact_params_t;
+
+typedef struct {
+    float offset;       // the live price is the path price times (1 + offset)
+} impact_t;
+
+/*
+ * `impact_set_halflife`
+ *
+ * Sets `decay` so that a displacement halves every `ticks` ticks.
+ */
+void impact_set_halflife(impact_params_t *params, int ticks);
+
+/*
+ * `impact_price`
+ *
+ * @return   the path price `path` moved by the current displacement
+ */
+float impact_price(const impact_t *impact, float path);
+
+/*
+ * `impact_set_price`
+ *
+ * Displaces the price from path price `path` to `price`, as far as
+ * IMPACT_MAX allows. The displacement then decays as usual.
+ */
+void impact_set_price(impact_t *impact, float path, float price);
+
+/*
+ * `impact_slippage`
+ *
+ * @return   how far the average price of a trade of `notional` cents
+ *           lies from the price before it, as a fraction of that price:
+ *           half the move for the linear model, two thirds for the
+ *           square root
+ */
+float impact_slippage(const impact_params_t *params, long notional);
+
+/*
+ * `impact_trade`
+ *
+ * Moves the displacement for a trade of `notional` cents by a taker on
+ * `side`.
+ */
+void impact_trade(impact_t *impact, const impact_params_t *params, side_t side, long notional);
+
+/*
+ * `impact_decay`
+ *
+ * Decays the displacement by one tick.
+ *
+ * @return   true if the displacement changed
+ */
+bool impact_decay(impact_t *impact, const impact_params_t *params);
+
+#endif
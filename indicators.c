@@ -0,0 +1,88 @@
+/* File: indicators.c
+ * ------------------
+ * This file implements the incremental indicators outlined in `indicators.h`
+ */
+#include <stdbool.h>
+#include "indicators.h"
+#include "mathlib.h"
+#include "strings.h"
+
+static const char *names[IND_COUNT] = {
+    [IND_SMA] = "sma",
+    [IND_EMA] = "ema",
+    [IND_STDDEV] = "std",
+    [IND_BB_UPPER] = "upper",
+    [IND_BB_LOWER] = "lower",
+    [IND_RSI] = "rsi",
+    [IND_VWAP] = "vwap",
+};
+
+void indicators_reset(indicators_t *ind) {
+    memset(ind, 0, sizeof(*ind));
+}
+
+void indicators_update(indicators_t *ind, float high, float low, float close, float volume) {
+    // SMA / stddev: replace the oldest sample once the window is full
+    if (ind->count >= IND_PERIOD) {
+        float old = ind->window[ind->head];
+        ind->sum -= old;
+        ind->sum_sq -= old * old;
+    }
+    ind->window[ind->head] = close;
+    ind->head = (ind->head + 1) % IND_PERIOD;
+    ind->sum += close;
+    ind->sum_sq += close * close;
+
+    // EMA with the usual 2 / (N + 1) smoothing, seeded with the first close
+    const float alpha = 2.0 / (IND_PERIOD + 1);
+    ind->ema = (ind->count == 0 ? close : ind->ema + alpha * (close - ind->ema));
+
+    // RSI with Wilder smoothing; plain average of the changes during warm-up
+    if (ind->count > 0) {
+        float change = close - ind->prev_close;
+        float gain = (change > 0 ? change : 0), loss = (change < 0 ? -change : 0);
+        int n = (ind->count < IND_RSI_PERIOD ? ind->count : IND_RSI_PERIOD);
+        ind->avg_gain += (gain - ind->avg_gain) / n;
+        ind->avg_loss += (loss - ind->avg_loss) / n;
+    }
+    ind->prev_close = close;
+
+    ind->pv += (high + low + close) / 3 * volume;
+    ind->volume += volume;
+
+    ind->count++;
+}
+
+static float stddev(const indicators_t *ind, int n) {
+    float mean = ind->sum / n;
+    float var = ind->sum_sq / n - mean * mean;
+    return var > 0 ? sqrt(var) : 0;
+}
+
+float indicators_value(const indicators_t *ind, indicator_id_t id) {
+    if (ind->count == 0) return 0;
+    int n = (ind->count < IND_PERIOD ? ind->count : IND_PERIOD);
+
+    switch (id) {
+        case IND_SMA: return ind->sum / n;
+        case IND_EMA: return ind->ema;
+        case IND_STDDEV: return stddev(ind, n);
+        case IND_BB_UPPER: return ind->sum / n + IND_BB_WIDTH * stddev(ind, n);
+        case IND_BB_LOWER: return ind->sum / n - IND_BB_WIDTH * stddev(ind, n);
+        case IND_RSI:
+            if (ind->avg_loss == 0) return (ind->avg_gain == 0 ? 50 : 100);
+            return 100 - 100 / (1 + ind->avg_gain / ind->avg_loss);
+        case IND_VWAP: return ind->volume > 0 ? ind->pv / ind->volume : 0;
+        default: return 0;
+    }
+}
+
+bool indicators_lookup(const char *name, indicator_id_t *id) {
+    for (int i = 0; i < IND_COUNT; i++) {
+        if (strcmp(name, names[i]) == 0) {
+            *id = i;
+            return true;
+        }
+    }
+    return false;
+}
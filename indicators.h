@@ -0,0 +1,78 @@
+#ifndef INDICATORS_H
+#define INDICATORS_H
+
+/*
+ * Incremental technical indicators.
+ *
+ * Each `indicators_t` holds the rolling state for one symbol. Feeding it
+ * one bar with `indicators_update` costs O(1) regardless of the window
+ * length: windowed sums are maintained by adding the newest sample and
+ * subtracting the one that falls out, and the exponential averages are
+ * updated in place.
+ */
+
+#define IND_PERIOD 20      // window for SMA / standard deviation / Bollinger bands
+#define IND_RSI_PERIOD 14  // Wilder smoothing period for RSI
+#define IND_BB_WIDTH 2     // Bollinger bands are SMA +/- IND_BB_WIDTH standard deviations
+
+typedef enum {
+    IND_SMA = 0,
+    IND_EMA,
+    IND_STDDEV,
+    IND_BB_UPPER,
+    IND_BB_LOWER,
+    IND_RSI,
+    IND_VWAP,
+    IND_COUNT,
+} indicator_id_t;
+
+typedef struct {
+    int count;                  // number of bars seen so far
+    float window[IND_PERIOD];   // circular buffer of the last IND_PERIOD closes
+    int head;                   // index of the oldest close in `window`
+    float sum, sum_sq;          // sum and sum of squares over `window`
+    float ema;
+    float prev_close, avg_gain, avg_loss;
+    float pv, volume;           // cumulative price * volume and volume for VWAP
+} indicators_t;
+
+/*
+ * `indicators_reset`
+ *
+ * Clears all rolling state.
+ */
+void indicators_reset(indicators_t *ind);
+
+/*
+ * `indicators_update`
+ *
+ * Feeds one bar into the rolling state.
+ *
+ * @param ind      the state for the symbol
+ * @param high     high price of the bar
+ * @param low      low price of the bar
+ * @param close    close price of the bar
+ * @param volume   traded volume of the bar (pass 1 when unknown; VWAP
+ *                 then reduces to the running mean of the typical price)
+ */
+void indicators_update(indicators_t *ind, float high, float low, float close, float volume);
+
+/*
+ * `indicators_value`
+ *
+ * Returns the current value of indicator `id`. During warm-up (fewer bars
+ * than the period) the windowed indicators use the bars seen so far.
+ */
+float indicators_value(const indicators_t *ind, indicator_id_t id);
+
+/*
+ * `indicators_lookup`
+ *
+ * Maps a user-facing name ("sma", "ema", "std", "upper", "lower", "rsi",
+ * "vwap") to its id.
+ *
+ * @return   true if `name` is a known indicator, false otherwise
+ */
+bool indicators_lookup(const char *name, indicator_id_t *id);
+
+#endif
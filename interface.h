@@ -12,4 +12,17 @@
 #include "shell.h"
 #include "shell_commands.h"
 
-int exchange_evaluate(const char *line);
+#define EXCHANGE_CONSOLE (-1) // untagged input from the directly attached console, which acts for client 0
+
+/*
+ * `exchange_evaluate`
+ *
+ * Runs one command line from `terminal`. The console (EXCHANGE_CONSOLE,
+ * also passed by the exchange's own order sources) acts for client 0 and
+ * may act for another client by starting the line with `@<client>`. A
+ * tagged terminal, numbered from 0, acts only for the client with its
+ * own id.
+ *
+ * @return   0 on success, -1 if the command failed
+ */
+int exchange_evaluate(int terminal, const char *line);
@@ -0,0 +1,150 @@
+/* File: journal.c
+ * ---------------
+ * This file implements the trade journal outlined in `journal.h`
+ */
+#include "journal.h"
+#ifdef HOSTED
+#include <stdio.h>
+#endif
+
+#define JOURNAL_MAGIC 0x4c4e524a // "JRNL"
+
+_Static_assert(sizeof(journal_record_t) == 32, "journal records are 32 bytes");
+
+#ifdef HOSTED
+
+// Hosted build: a file of records after a header record, which holds
+// the magic number in `id` and the sequence number before the first
+// record in `ref`
+
+static struct {
+    FILE *fp;
+    uint32_t base, last;
+} module;
+
+static void seek_record(uint32_t seq) {
+    // positions the file at record `seq`; the header is record `base`
+    fseek(module.fp, (long)(seq - module.base) * (long)sizeof(journal_record_t), SEEK_SET);
+}
+
+void journal_init(void) {
+    module.fp = fopen(JOURNAL_FILE, "rb+");
+    journal_record_t hdr;
+    if (module.fp == NULL || fread(&hdr, sizeof(hdr), 1, module.fp) != 1 || hdr.type != 0 || hdr.id != JOURNAL_MAGIC) {
+        journal_reset(0);
+        return;
+    }
+    fseek(module.fp, 0, SEEK_END);
+    long records = ftell(module.fp) / (long)sizeof(journal_record_t) - 1;
+    module.base = hdr.ref;
+    module.last = module.base + records;
+    seek_record(module.last + 1); // a torn last record is overwritten by the next append
+}
+
+uint32_t journal_append(const journal_record_t *rec) {
+    if (module.fp == NULL || fwrite(rec, sizeof(*rec), 1, module.fp) != 1) return 0;
+    return ++module.last;
+}
+
+uint32_t journal_last(void) {
+    return module.last;
+}
+
+uint32_t journal_first(void) {
+    return module.base + 1;
+}
+
+int journal_replay(uint32_t after, journal_fn_t fn, void *aux) {
+    if (module.fp == NULL) return 0;
+    if (after < module.base) after = module.base;
+    fflush(module.fp);
+    seek_record(after + 1);
+    int n = 0;
+    journal_record_t rec;
+    for (uint32_t seq = after + 1; seq <= module.last && fread(&rec, sizeof(rec), 1, module.fp) == 1; seq++) {
+        fn(seq, &rec, aux);
+        n++;
+    }
+    seek_record(module.last + 1);
+    return n;
+}
+
+void journal_sync(void) {
+    if (module.fp != NULL) fflush(module.fp);
+}
+
+void journal_reset(uint32_t after) {
+    if (module.fp != NULL) fclose(module.fp);
+    module.fp = fopen(JOURNAL_FILE, "wb+");
+    module.base = module.last = after;
+    journal_record_t hdr = { .type = 0, .id = JOURNAL_MAGIC, .ref = after };
+    if (module.fp != NULL) fwrite(&hdr, sizeof(hdr), 1, module.fp);
+}
+
+#else
+
+// Board: a ring of records after a header; record `seq` is at index `seq % JOURNAL_CAPACITY`
+
+#define JOURNAL_CAPACITY (JOURNAL_SIZE / sizeof(journal_record_t) - 1)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t base;  // sequence number before the first record
+    uint32_t last;  // sequence number of the newest record
+} header_t;
+
+static header_t *header(void) {
+    return (header_t *)(uintptr_t)JOURNAL_ADDR;
+}
+
+static journal_record_t *record(uint32_t seq) {
+    return (journal_record_t *)(uintptr_t)(JOURNAL_ADDR + sizeof(journal_record_t)) + seq % JOURNAL_CAPACITY;
+}
+
+void journal_init(void) {
+    header_t *hdr = header();
+    if (hdr->magic != JOURNAL_MAGIC || hdr->last < hdr->base) {
+        journal_reset(0);
+    }
+}
+
+uint32_t journal_append(const journal_record_t *rec) {
+    // the record is complete before `last` counts it, so a reboot mid-append loses only that record
+    header_t *hdr = header();
+    *record(hdr->last + 1) = *rec;
+    return ++hdr->last;
+}
+
+uint32_t journal_last(void) {
+    return header()->last;
+}
+
+uint32_t journal_first(void) {
+    header_t *hdr = header();
+    uint32_t oldest = (hdr->last > JOURNAL_CAPACITY ? hdr->last - JOURNAL_CAPACITY + 1 : 1);
+    return (oldest > hdr->base ? oldest : hdr->base + 1);
+}
+
+int journal_replay(uint32_t after, journal_fn_t fn, void *aux) {
+    uint32_t first = journal_first();
+    if (after + 1 < first) after = first - 1;
+    int n = 0;
+    for (uint32_t seq = after + 1; seq <= header()->last; seq++) {
+        fn(seq, record(seq), aux);
+        n++;
+    }
+    return n;
+}
+
+void journal_sync(void) {
+    // memory writes are already in place
+}
+
+void journal_reset(uint32_t after) {
+    header_t *hdr = header();
+    hdr->magic = 0;
+    hdr->base = hdr->last = after;
+    hdr->magic = JOURNAL_MAGIC;
+}
+
+#endif
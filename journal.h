@@ -0,0 +1,108 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+/*
+ * Append-only trade journal.
+ *
+ * Every accepted order, every cancel and every fill is appended as one
+ * fixed-size 32-byte record. Appending is a copy into memory, so the
+ * journal costs the order path next to nothing. Records are numbered from
+ * 1 by their position (their sequence number). Replaying the records
+ * that follow a checkpoint rebuilds the state at the last record.
+ *
+ * On the board, the journal is a ring in reserved DRAM just below the
+ * checkpoint slots. Like them it survives a warm reboot but not a power
+ * cycle. Once the ring is full the oldest records are overwritten. A
+ * hosted build (compiled with -DHOSTED) appends to the file JOURNAL_FILE
+ * instead. Writes are buffered until `journal_sync`.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef JOURNAL_ADDR
+#define JOURNAL_ADDR 0x5fc00000 // 2MB reserved just below the checkpoint slots
+#endif
+#define JOURNAL_SIZE 0x200000
+#ifndef JOURNAL_FILE
+#define JOURNAL_FILE "exchange.jnl"
+#endif
+
+typedef enum {
+    JOURNAL_ORDER = 1,  // accepted order: id, price (its limit), qty, aux (expiry), flags (time in force)
+    JOURNAL_CANCEL,     // shares taken off an order by a cancel, reduce, expiry or time in force: id, price, qty
+    JOURNAL_FILL,       // execution: id (taker), ref (maker), price, qty, aux (taker limit), side of the taker, other (maker account)
+    JOURNAL_OPEN,       // account opened, or reopened empty by a bankruptcy
+    JOURNAL_BASIS,      // cost basis method changed: flags is 1 for average cost, 0 for FIFO lots
+    JOURNAL_STOP,       // stop added: id, price (its trigger), aux (its limit, or -1 for market), qty
+    JOURNAL_STOP_END,   // stop removed: id; flags is 1 if it triggered, 0 if cancelled
+} journal_type_t;
+
+typedef struct {
+    uint8_t type, side, symbol, flags;
+    int32_t clock;          // session time of the event, in intraday ticks
+    int16_t account, other; // account acting; for fills, the taker's and the maker's
+    uint32_t id, ref;
+    int32_t price, qty, aux;
+} journal_record_t;
+
+typedef void (*journal_fn_t)(uint32_t seq, const journal_record_t *rec, void *aux);
+
+/*
+ * `journal_init`: Required initialization for module
+ *
+ * Finds the records kept from before a (warm) reboot, or starts an
+ * empty journal if there are none.
+ */
+void journal_init(void);
+
+/*
+ * `journal_append`
+ *
+ * Appends `rec` to the journal.
+ *
+ * @return   its sequence number
+ */
+uint32_t journal_append(const journal_record_t *rec);
+
+/*
+ * `journal_last`
+ *
+ * @return   the sequence number of the newest record, or the number the
+ *           journal was last reset to if it has none since
+ */
+uint32_t journal_last(void);
+
+/*
+ * `journal_first`
+ *
+ * @return   the sequence number of the oldest record still kept; greater
+ *           than `journal_last` if the journal is empty
+ */
+uint32_t journal_first(void);
+
+/*
+ * `journal_replay`
+ *
+ * Passes every kept record numbered after `after` to `fn`, oldest first.
+ *
+ * @return   the number of records passed
+ */
+int journal_replay(uint32_t after, journal_fn_t fn, void *aux);
+
+/*
+ * `journal_sync`
+ *
+ * Makes every appended record durable. The journal must be synced before
+ * a checkpoint that records its length is saved.
+ */
+void journal_sync(void);
+
+/*
+ * `journal_reset`
+ *
+ * Discards every record. The next record appended is numbered `after` + 1.
+ */
+void journal_reset(uint32_t after);
+
+#endif
@@ -0,0 +1,81 @@
+/* File: lots.c
+ * ------------
+ * This file implements the cost-basis lots outlined in `lots.h`
+ */
+#include "lots.h"
+
+static lot_t *newest(lots_t *lots) {
+    return &lots->lot[(lots->head + lots->n - 1) % LOTS_MAX];
+}
+
+static int64_t close_oldest(lots_t *lots, int qty) {
+    // Closes `qty` shares of the oldest lots; returns their cost, signed like the lots
+    int64_t basis = 0;
+    while (qty > 0) {
+        lot_t *lot = &lots->lot[lots->head];
+        int held = (lot->qty < 0 ? -lot->qty : lot->qty);
+        if (qty >= held) { // close the whole lot
+            qty -= held;
+            lots->qty -= lot->qty;
+            basis += lot->cost;
+            lots->head = (lots->head + 1) % LOTS_MAX;
+            lots->n--;
+        } else {
+            int64_t part = lot->cost * qty / held;
+            int32_t closed = (lot->qty < 0 ? -qty : qty);
+            lot->qty -= closed;
+            lot->cost -= part;
+            lots->qty -= closed;
+            basis += part;
+            qty = 0;
+        }
+    }
+    lots->cost -= basis;
+    return basis;
+}
+
+static void open_lot(lots_t *lots, int qty, int32_t price, bool average) {
+    // Adds `qty` shares (negative for a short sale) at `price` cents each
+    if (qty == 0) return;
+    int64_t cost = (int64_t)qty * price;
+    lots->qty += qty;
+    lots->cost += cost;
+    if (lots->n > 0 && (average || lots->n == LOTS_MAX)) {
+        lot_t *lot = newest(lots);
+        lot->qty += qty;
+        lot->cost += cost;
+        return;
+    }
+    lots->n++;
+    *newest(lots) = (lot_t){ qty, cost };
+}
+
+int64_t lots_buy(lots_t *lots, int qty, int32_t price, bool average) {
+    int64_t realized = 0;
+    if (lots->qty < 0) { // cover the short first
+        int covered = (qty < -lots->qty ? qty : -lots->qty);
+        int64_t proceeds = -close_oldest(lots, covered);
+        realized = proceeds - (int64_t)covered * price;
+        qty -= covered;
+    }
+    open_lot(lots, qty, price, average);
+    return realized;
+}
+
+int64_t lots_sell(lots_t *lots, int qty, int32_t price, bool average) {
+    int64_t realized = 0;
+    if (lots->qty > 0) { // sell what is held first
+        int sold = (qty < lots->qty ? qty : lots->qty);
+        realized = (int64_t)sold * price - close_oldest(lots, sold);
+        qty -= sold;
+    }
+    open_lot(lots, -qty, price, average);
+    return realized;
+}
+
+void lots_merge(lots_t *lots) {
+    if (lots->n <= 1) return;
+    lots->head = 0;
+    lots->n = 1;
+    lots->lot[0] = (lot_t){ lots->qty, lots->cost };
+}
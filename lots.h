@@ -0,0 +1,69 @@
+#ifndef LOTS_H
+#define LOTS_H
+
+/*
+ * Cost-basis lots of a single position.
+ *
+ * Each buy opens a lot recording its quantity and total cost; sells close
+ * the oldest lots first (FIFO) and realize the difference between sale
+ * proceeds and the cost of the shares closed. A sale beyond the shares
+ * held opens a short lot, with negative quantity and cost (the proceeds),
+ * which later buys cover the same way. Lots live in a fixed ring,
+ * so a position never takes more than LOTS_MAX lots: a trade that finds
+ * the ring full is merged into the newest lot at their average cost.
+ * Average-cost accounting is the same ring with every trade merged into
+ * one lot. All lots of a position are on the same side.
+ *
+ * Costs are kept as exact cent totals, not per-share prices, so merging
+ * and partial closes never lose a cent: a partial close takes its share
+ * of the lot's cost rounded toward zero and the remainder stays with the
+ * lot.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define LOTS_MAX 8 // lots kept per position before merging
+
+typedef struct {
+    int32_t qty;
+    int64_t cost; // cents paid for the lot's `qty` shares
+} lot_t;
+
+typedef struct {
+    lot_t lot[LOTS_MAX]; // ring, oldest at `head`
+    uint8_t head, n;
+    int32_t qty;         // total shares over all lots
+    int64_t cost;        // total cost over all lots, in cents
+} lots_t;
+
+/*
+ * `lots_buy`
+ *
+ * Adds `qty` shares bought at `price` cents each, covering any short
+ * lots first.
+ *
+ * @param average   true to merge into the newest lot (average-cost accounting)
+ * @return          profit (or loss, if negative) realized by covering, in cents
+ */
+int64_t lots_buy(lots_t *lots, int qty, int32_t price, bool average);
+
+/*
+ * `lots_sell`
+ *
+ * Closes `qty` shares sold at `price` cents each, oldest lots first; any
+ * shares sold beyond those held open a short lot.
+ *
+ * @param average   true to merge into the newest lot (average-cost accounting)
+ * @return          realized profit (or loss, if negative) in cents
+ */
+int64_t lots_sell(lots_t *lots, int qty, int32_t price, bool average);
+
+/*
+ * `lots_merge`
+ *
+ * Merges every lot into one at the average cost.
+ */
+void lots_merge(lots_t *lots);
+
+#endif
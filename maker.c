@@ -0,0 +1,33 @@
+/* File: maker.c
+ * -------------
+ * This file implements the market maker's quotes outlined in `maker.h`
+ */
+#include "maker.h"
+
+#define BP 10000 // basis points in a whole
+
+void maker_quote(const maker_params_t *params, price_t reference, int inventory, maker_quote_t *quote) {
+    int max = (params->max_inventory > 0 ? params->max_inventory : 1);
+    if (inventory > max) inventory = max;
+    if (inventory < -max) inventory = -max;
+
+    // reservation price: the reference, skewed against the inventory
+    long reservation = reference - (long)reference * params->skew_bp * inventory / max / BP;
+    long half = (long)reservation * params->half_spread_bp / BP;
+    if (half < 1) half = 1;
+    quote->bid = reservation - half;
+    quote->ask = reservation + half;
+    if (quote->bid >= reference) quote->bid = reference - 1;
+    if (quote->ask <= reference) quote->ask = reference + 1;
+    if (quote->bid < 1) quote->bid = 1;
+
+    // the side that adds to the inventory shrinks as it grows
+    int room_long = max - inventory, room_short = max + inventory;
+    quote->bid_qty = (room_long < params->size ? room_long : params->size);
+    quote->ask_qty = (room_short < params->size ? room_short : params->size);
+}
+
+bool maker_stale(const maker_params_t *params, price_t quoted, price_t reference) {
+    long moved = (reference > quoted ? reference - quoted : quoted - reference);
+    return moved * BP >= (long)quoted * params->requote_bp;
+}
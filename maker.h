@@ -0,0 +1,48 @@
+#ifndef MAKER_H
+#define MAKER_H
+
+/*
+ * Quotes of the built-in market maker.
+ *
+ * The maker quotes a bid and an ask around a reference price. Its
+ * inventory skews both: a long maker shifts its quotes down, so it buys
+ * less readily and sells more readily, and a short one shifts them up.
+ * The side that would grow the inventory also quotes fewer shares, and
+ * none at all once the inventory reaches its limit. A quote is a pure
+ * function of the reference price and the inventory, so computing one is
+ * O(1) and the maker only needs to re-quote when either changes.
+ */
+
+#include "book.h"
+
+typedef struct {
+    int half_spread_bp;     // quotes sit this far either side of the reservation price, in basis points
+    int skew_bp;            // the reservation price moves this far per full inventory, in basis points
+    int size;               // shares quoted on each side when flat
+    int max_inventory;      // largest position either way
+    int requote_bp;         // quotes stand until the reference moves this far, in basis points
+} maker_params_t;
+
+typedef struct {
+    price_t bid, ask;
+    int bid_qty, ask_qty;   // 0 when the side is not quoted
+} maker_quote_t;
+
+/*
+ * `maker_quote`
+ *
+ * Computes the quotes for a maker holding `inventory` shares (negative
+ * when short) around `reference`, in cents. The bid is strictly below
+ * the reference and the ask strictly above it.
+ */
+void maker_quote(const maker_params_t *params, price_t reference, int inventory, maker_quote_t *quote);
+
+/*
+ * `maker_stale`
+ *
+ * @return   true if quotes made at reference `quoted` should be replaced
+ *           now that the reference is `reference`
+ */
+bool maker_stale(const maker_params_t *params, price_t quoted, price_t reference);
+
+#endif
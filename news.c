@@ -0,0 +1,1589 @@
+/* File: news.c
+ * -------------
+ * This file implements the news store outlined in `news.h`
+ */
+#include "news.h"
+#include "malloc.h"
+#include "strings.h"
+
+// Data obtained via Claude AI
+// Headlines of each bar, each NUL-terminated; an empty string closes the bar
+static const char pool[] =
+    // Dec 2015
+    "Federal Reserve raises interest rates for first time in nearly a decade\0"
+    "Oil prices fall below $35 per barrel amid global supply glut\0"
+    "Yahoo scraps plan to spin off Alibaba stake after tax concerns\0"
+    "Toshiba to cut 7,000 jobs after $1.3 billion accounting scandal\0"
+    "McDonald's moves tax base to UK in $3.2 billion restructuring\0"
+    "Puerto Rico defaults on portion of $73 billion debt\0"
+    "Chipotle shares plummet as E. coli outbreak expands across US\0"
+    "DuPont and Dow Chemical agree to $130 billion mega-merger\0"
+    "Valeant discloses criminal probe over pricing practices\0"
+    "Apple shares tumble as iPhone sales growth slows\0"
+    "\0"
+
+    // Jan 2016
+    "China's stock market turmoil rattles global markets\0"
+    "Oil prices plunge below $30 per barrel amid supply glut\0"
+    "US imposes new sanctions on Iran after missile test\0"
+    "Volkswagen emissions scandal costs continue to mount\0"
+    "Yahoo explores sale of core internet business\0"
+    "US job growth slows in December as wages rise\0"
+    "Dow drops over 400 points as China slowdown fears persist\0"
+    "Netflix shares tumble on weak subscriber growth forecast\0"
+    "Amazon reports record holiday sales but misses expectations\0"
+    "Apple's quarterly revenue declines for first time since 2003\0"
+    "\0"
+
+    // Feb 2016
+    "Stock market rout continues as oil prices slide further\0"
+    "US Fed keeps interest rates unchanged amid market turmoil\0"
+    "Apple's fight with FBI over iPhone encryption escalates\0"
+    "Tesco faces record $6.5 billion overstatement fine\0"
+    "Twitter shares plunge as user growth stalls\0"
+    "Alphabet (Google) overtakes Apple as world's most valuable company\0"
+    "Takata agrees to record $200 million fine over faulty airbags\0"
+    "Pfizer and Allergan scrap $160 billion merger deal\0"
+    "US job growth rebounds in January after weak December\0"
+    "Amazon shares soar as AWS cloud business shines\0"
+    "\0"
+
+    // Mar 2016
+    "ECB launches fresh stimulus measures to boost eurozone economy\0"
+    "Oil prices recover but remain volatile amid oversupply\0"
+    "Yahoo set to cut workforce by 15% amid turnaround struggles\0"
+    "FBI unlocks San Bernardino shooter's iPhone without Apple's help\0"
+    "Valeant faces criminal probe over pharmaceutical pricing\0"
+    "US Fed leaves interest rates unchanged, signals caution\0"
+    "Marriott completes $13 billion acquisition of Starwood Hotels\0"
+    "Apple unveils smaller iPhone SE and new iPad Pro models\0"
+    "Tesla aims to become a mass-market automaker with Model 3 launch\0"
+    "Lufthansa strikes ground hundreds of flights across Europe\0"
+    "\0"
+
+    // Apr 2016
+    "Saudi Arabia unveils radical plan to reduce oil dependency\0"
+    "Volkswagen reaches $4.3 billion US criminal settlement over emissions\0"
+    "Microsoft sues US government over data privacy violations\0"
+    "OPEC and non-OPEC producers fail to reach output freeze deal\0"
+    "Amazon shares soar after blowing past profit expectations\0"
+    "Twitter shares plummet as revenue growth stalls\0"
+    "Puerto Rico defaults on $422 million debt payment\0"
+    "Chernobyl nuclear disaster costs still emerging after 30 years\0"
+    "Tesla aims for volume production of Model 3 by late 2017\0"
+    "Mitsubishi admits to falsifying fuel economy data for 25 years\0"
+    "\0"
+
+    // May 2016
+    "Oil prices surge as Goldman Sachs forecasts supply deficit\0"
+    "Microsoft agrees to buy LinkedIn for $26.2 billion\0"
+    "Verizon strikes $4.8 billion deal to acquire Yahoo's core business\0"
+    "Bayer offers $62 billion to acquire Monsanto in agrochemical mega-merger\0"
+    "Britain's pound hits lowest level since 1985 as Brexit fears mount\0"
+    "Gawker files for bankruptcy after losing Hulk Hogan privacy case\0"
+    "Regulators hit five global banks with $5.7 billion in fines\0"
+    "Alibaba reports booming revenue growth, but profit disappoints\0"
+    "Tesla aims to make history with release of affordable Model 3\0"
+    "Puerto Rico missses debt payment, deepening financial crisis\0"
+    "\0"
+
+    // Jun 2016
+    "Brexit vote shocks global markets, British pound plunges\0"
+    "Volkswagen to pay $15 billion settlement in emissions scandal\0"
+    "Walmart to acquire online retailer Jet.com for $3 billion\0"
+    "Tesla and SolarCity agree to $2.6 billion merger\0"
+    "Microsoft to buy LinkedIn for $26.2 billion in largest deal\0"
+    "Airbnb raises $1 billion in funding, valued at $30 billion\0"
+    "Verizon to acquire Yahoo's core business for $4.8 billion\0"
+    "Uber raises $3.5 billion from Saudi investment fund\0"
+    "Amazon to open more bookstores after opening first location\0"
+    "Takata recalls 35 million more airbags in largest auto recall\0"
+    "\0"
+
+    // Jul 2016
+    "Brexit turmoil deepens as PM David Cameron resigns\0"
+    "Verizon agrees to buy Yahoo's core business for $4.83 billion\0"
+    "Tesla unveils 'master plan' for self-driving cars and trucks\0"
+    "Anheuser-Busch InBev raises offer for SABMiller to $104 billion\0"
+    "Microsoft's cloud business boosts revenue amid PC slump\0"
+    "China's economic growth slows to 6.7%, weakest since 2009\0"
+    "Airbnb faces growing backlash from regulators over rentals\0"
+    "Volkswagen agrees to $14.7 billion settlement in emissions scandal\0"
+    "Amazon unveils Prime Air, a future drone delivery service\0"
+    "Uber loses $1.27 billion in first half of 2016 amid expansion\0"
+    "\0"
+
+    // Aug 2016
+    "Apple issues $7 billion bond to fund share buybacks, dividends\0"
+    "Pfizer to buy cancer drug maker Medivation for $14 billion\0"
+    "Uber loses $1.27 billion in first half amid expansion\0"
+    "Mylan's EpiPen pricing raises allegations of price gouging\0"
+    "Walmart to acquire e-commerce startup Jet.com for $3 billion\0"
+    "Oil prices rebound as Saudi Arabia and Russia agree output freeze\0"
+    "Apple hit with $14.5 billion tax bill from European Commission\0"
+    "Mondelez calls off $23 billion bid for Hershey after rejection\0"
+    "WhatsApp to start sharing user data with Facebook after policy change\0"
+    "EpiPen maker Mylan to launch generic version amid pricing backlash\0"
+    "\0"
+
+    // Sep 2016
+    "Wells Fargo fined $185 million for widespread illegal practices\0"
+    "Pfizer decides against splitting into two companies\0"
+    "Uber starts self-driving car pickups in Pittsburgh\0"
+    "Yahoo confirms data breach affecting 500 million accounts\0"
+    "Samsung recalls Galaxy Note 7 after battery explosion reports\0"
+    "Bayer acquires Monsanto for $66 billion in record agriculture deal\0"
+    "OPEC agrees to first oil output cut in 8 years to boost prices\0"
+    "Deutsche Bank shares plunge amid $14 billion U.S. settlement demand\0"
+    "Snapchat unveils video-recording Spectacles, rebrands as Snap Inc.\0"
+    "Alphabet's Google launches smartphone, virtual reality headset\0"
+    "\0"
+
+    // Oct 2016
+    "AT&T agrees to buy Time Warner for $85.4 billion\0"
+    "Tesla unveils solar roof tiles, Powerwall 2 energy storage\0"
+    "Samsung halts Galaxy Note 7 production amid fire concerns\0"
+    "Microsoft shares hit all-time high on cloud growth\0"
+    "Rockwell Automation rejects $27.5 billion takeover bid from Emerson\0"
+    "Ethereum blockchain tech firm raises $200 million in record funding\0"
+    "Third cyber attack on Dyn disrupts internet across the U.S.\0"
+    "Twitter axes 9 pct of workforce as revenue growth stalls\0"
+    "Visa shares hit record high after strong Q4 earnings report\0"
+    "Amazon shares surge as revenue beats expectations\0"
+    "\0"
+
+    // Nov 2016
+    "Donald Trump wins US presidential election, markets plunge\0"
+    "Walmart agrees to $3.3 billion settlement over bribery charges\0"
+    "Samsung to buy Harman for $8 billion to boost automotive business\0"
+    "Opec agrees to cut oil production in bid to raise prices\0"
+    "UK government approves $24 billion nuclear power plant deal\0"
+    "Alibaba smashes sales records on Singles Day shopping event\0"
+    "Starbucks opens first premium Reserve bakery cafe\0"
+    "Snapchat parent files for $25 billion IPO valuation\0"
+    "Amazon develops AI-powered checkout-free grocery store\0"
+    "Uber faces more legal challenges over self-driving car project\0"
+    "\0"
+
+    // Dec 2016
+    "Dow crosses 20,000 milestone for the first time\0"
+    "Yahoo reveals 1 billion user accounts were hacked in 2013 breach\0"
+    "Uber shifts gears with $1 billion deal for self-driving startup\0"
+    "Samsung blames battery flaws for Galaxy Note 7 fires\0"
+    "Apple supplier Foxconn weighs $7 billion investment in US\0"
+    "Trump claims $50 billion SoftBank investment after meeting\0"
+    "Deutsche Bank agrees to $7.2 billion mortgage settlement\0"
+    "Snapchat confidentially files for $25 billion IPO valuation\0"
+    "Coca-Cola appoints Quincey as new CEO to succeed Muhtar Kent\0"
+    "Amazon hits $1,000 stock price with market cap above $475 billion\0"
+    "\0"
+
+    // Jan 2017
+    "Dow hits 20,000 for the first time as Trump rally continues\0"
+    "Netflix adds more subscribers than expected, shares surge\0"
+    "Snapchat parent Snap Inc. aims to raise $3 billion in IPO\0"
+    "Trump withdraws from Trans-Pacific Partnership trade deal\0"
+    "Samsung blames battery flaws for Galaxy Note 7 fires\0"
+    "Alibaba becomes major sponsor of Olympic Games through 2028\0"
+    "Starbucks to hire 10,000 refugees over next 5 years\0"
+    "GM to invest $1 billion in U.S. factories, add or keep 7,000 jobs\0"
+    "Apple files $1 billion lawsuit against Qualcomm over royalties\0"
+    "Uber hires NASA engineer to lead flying car project\0"
+    "\0"
+
+    // Feb 2017
+    "Snap Inc. prices IPO at $17 per share, valuing it at $24 billion\0"
+    "Kraft Heinz drops $143 billion bid for Unilever after rejection\0"
+    "Tesla swings to profit, driven by record electric vehicle sales\0"
+    "Uber CEO orders 'urgent' investigation into harassment claims\0"
+    "Amazon to create 100,000 full-time jobs in U.S. over next 18 months\0"
+    "Apple joins group working on open-source artificial intelligence\0"
+    "Samsung chief Lee Jae-yong arrested in corruption scandal\0"
+    "Walmart to create 10,000 U.S. jobs as part of investment plan\0"
+    "Verizon announces $350 million investment, reversing job cuts\0"
+    "Burger King and Tim Hortons owner to buy Popeyes for $1.8 billion\0"
+    "\0"
+
+    // Mar 2017
+    "Snap shares soar 44 pct on debut after $3.4 billion IPO\0"
+    "Amazon to acquire Middle Eastern online retailer Souq.com\0"
+    "Uber presidency left vacant amid turmoil at the company\0"
+    "Apple unveils new iPad and special edition iPhone 7 & 7 Plus\0"
+    "Google apologizes after ads appear next to extremist videos\0"
+    "Sears warns of 'going concern' doubts amid $2.2 billion loss\0"
+    "Toshiba's Westinghouse nuclear unit files for bankruptcy\0"
+    "Wells Fargo agrees to pay $142 million in fake account scandal\0"
+    "Ford to invest $1.2 billion in three Michigan plants\0"
+    "EU blocks London Stock Exchange's $28 billion merger with Deutsche Boerse\0"
+    "\0"
+
+    // Apr 2017
+    "United Airlines passenger violently dragged from overbooked flight\0"
+    "Tesla overtakes GM as most valuable US automaker\0"
+    "Uber caught tracking ex-users after them uninstalling app\0"
+    "Verizon launches unlimited data plan amid fierce competition\0"
+    "Wells Fargo claws back $75 million more from former executives\0"
+    "Bidding war erupts for $24 billion truck maker Navistar\0"
+    "Facebook's Messenger app tops 1.2 billion monthly users\0"
+    "FCC unveils plan to repeal Obama-era 'net neutrality' rules\0"
+    "Nintendo Switch sales top 2.7 million units in less than a month\0"
+    "Amazon acquires Dubai online retailer Souq.com for $650 million\0"
+    "\0"
+
+    // May 2017
+    "Uber admits 'major' underpayment blunder for NYC drivers\0"
+    "Amazon shares top $1,000 for the first time amid retail domination\0"
+    "Ford replaces CEO Mark Fields amid plunging share price\0"
+    "Microsoft refreshes Surface Pro, launches Windows 10 Fall update\0"
+    "Moody's downgrades China's credit rating amid debt concerns\0"
+    "Google's Android platform was a billion-dollar transfer from Apple\0"
+    "Cisco to lay off 1,100 more employees in extended restructuring\0"
+    "Bitcoin surges above $2,000 as global demand intensifies\0"
+    "Zuckerberg urges Harvard grads to embrace globalization\0"
+    "OPEC and allies extend production cuts to end of 2018\0"
+    "\0"
+
+    // Jun 2017
+    "Amazon to acquire Whole Foods for $13.7 billion\0"
+    "Uber CEO Travis Kalanick forced to resign after investor revolt\0"
+    "Google faces $2.7 billion EU fine for favoring its shopping service\0"
+    "Berkshire Hathaway buys 38.6 pct stake in trucker Pilot Flying J\0"
+    "Walmart reportedly exploring way to offer low-cost streaming service\0"
+    "Boeing strikes deal to sell planes to Iran worth $20 billion\0"
+    "Elon Musk offers to help rebuild Puerto Rico's power grid\0"
+    "Alibaba joins bidding war for India's leading e-commerce company\0"
+    "Petya cyber attack strikes companies across Europe and US\0"
+    "Google to stop scanning Gmail for ad targeting\0"
+    "\0"
+
+    // Jul 2017
+    "Amazon's Prime Day sales topped $1 billion despite website issues\0"
+    "FTC approves $13.7 billion acquisition of Whole Foods by Amazon\0"
+    "Elon Musk's Tesla to build world's largest battery in Australia\0"
+    "Blue Apron slashes IPO price as Amazon looms in meal-kit market\0"
+    "Michael Kors to buy luxury shoemaker Jimmy Choo for $1.2 billion\0"
+    "Alphabet beats expectations despite $2.7 billion EU antitrust fine\0"
+    "Uber's legal woes worsen as ex-employee alleges coverup effort\0"
+    "PayPal to integrate with Amazon's Alexa digital assistant\0"
+    "Daimler to recall 3 million Mercedes-Benz diesels in Europe\0"
+    "Foxconn unveils plan to build $10 billion LCD factory in Wisconsin\0"
+    "\0"
+
+    // Aug 2017
+    "Amazon issues $16 billion bond sale to fund Whole Foods deal\0"
+    "Tesla bonds price with junk rating, 5.3% yield amid cash burn\0"
+    "Disney to launch ESPN and Disney-branded streaming services\0"
+    "Uber agrees to 20 years of privacy audits to settle charges\0"
+    "Tencent becomes world's 10th largest company by market value\0"
+    "Alibaba beats expectations as online sales in China surge\0"
+    "Sempra Energy to buy Oncor for $9.45 billion after Buffett bows out\0"
+    "Samsung unveils Galaxy Note 8 after battery fiasco\0"
+    "Walmart partners with Google on voice-based shopping\0"
+    "BlackBerry misses sales forecasts, shares tumble\0"
+    "\0"
+
+    // Sep 2017
+    "Equifax breach exposed data of 143 million U.S. consumers\0"
+    "Apple unveils $999 iPhone X with face recognition technology\0"
+    "SEC reveals cyber breach, raising concerns about internal lapses\0"
+    "Toys 'R' Us files for bankruptcy amid crushing debt load\0"
+    "Uber loses license to operate in London after sexual assaults\0"
+    "Northrop Grumman buys aerospace firm Orbital ATK for $9.2 billion\0"
+    "Facebook says it will hand Russian ads over to Congress\0"
+    "Tesla working with AMD to develop chip for self-driving cars\0"
+    "Amazon plans second headquarters, opens $5 billion investment bidding\0"
+    "Lufthansa in talks to buy parts of insolvent Air Berlin\0"
+    "\0"
+
+    // Oct 2017
+    "Amazon receives 238 proposals for its second headquarters\0"
+    "Kobe Steel faked product data for over 10 years, sending shockwaves\0"
+    "Alphabet's Google uncovers Russia-backed ads on YouTube, Gmail\0"
+    "Tesla fires hundreds of workers as company struggles with production\0"
+    "Airbus to acquire majority stake in Bombardier C Series program\0"
+    "AT&T's $85 billion acquisition of Time Warner hit with lawsuit\0"
+    "CVS Health to acquire health insurer Aetna for $69 billion\0"
+    "Intel products hit with security flaw in widespread 'KRACK' attack\0"
+    "Bitcoin soars above $6,000, doubling in price in less than a month\0"
+    "Disney extends buyout negotiations after hitting a 'slew of issues'\0"
+    "\0"
+
+    // Nov 2017
+    "Saudi Arabia's sovereign wealth fund builds $2 billion stake in Uber\0"
+    "Broadcom bids $130 billion for Qualcomm in landmark deal\0"
+    "Alibaba smashes Singles Day record with over $25 billion in sales\0"
+    "Bitcoin surges past $8,000 as investors pile into cryptocurrency\0"
+    "Uber loses lawsuit against Waymo over alleged tech theft\0"
+    "Amazon Web Services outage wreaks havoc across the internet\0"
+    "Toshiba agrees to sell chip unit to Bain Capital for $18 billion\0"
+    "Volvo to supply Uber with up to 24,000 self-driving cars\0"
+    "AT&T's $85 billion acquisition of Time Warner approved by judges\0"
+    "Tesla unveils its first electric semi-truck and new Roadster\0"
+    "\0"
+
+    // Dec 2017
+    "Bitcoin futures make debut on major exchanges, prices surge\0"
+    "Congressional Republicans reach deal on final tax overhaul bill\0"
+    "Disney agrees to buy key 21st Century Fox assets for $52.4 billion\0"
+    "Fed raises interest rates amid stronger economic growth\0"
+    "Apple faces lawsuits after admitting to slowing down older iPhones\0"
+    "Uber sells stake to SoftBank achieving $48 billion valuation\0"
+    "Cryptocurrency bitcoin breaks through $20,000 milestone\0"
+    "Overstock becomes first major retailer to accept cryptocurrency\0"
+    "Trump blocks $1.2 billion Moneygram acquisition by Alibaba affiliate\0"
+    "Facebook to book tax expenses related to Republican tax reforms\0"
+    "\0"
+
+    // Jan 2018
+    "Cryptocurrency markets suffer historic price crash and volatility\0"
+    "Apple plans to pay $38 billion in tax on overseas cash\0"
+    "Amazon climbs into elite club of $1 trillion companies\0"
+    "Facebook overhauls News Feed to focus on friends and family\0"
+    "Intel hit with three lawsuits over security flaw in chip designs\0"
+    "Meltdown and Spectre flaws affect virtually all modern processors\0"
+    "Tesla delays Model 3 production targets yet again\0"
+    "YouTube pulls ads from Logan Paul videos over suicide forest clip\0"
+    "SpaceX launches secret Zuma payload, but mission status is unconfirmed\0"
+    "GM launches new Chevrolet Silverado pickup to take on Ford F-150\0"
+    "\0"
+
+    // Feb 2018
+    "Dow plunges nearly 1,600 points, its biggest intraday point drop ever\0"
+    "Jeff Bezos tops Bill Gates as world's richest person\0"
+    "Snapchat update leads to backlash and 1.2 million signed petition\0"
+    "Elon Musk's Tesla Roadster launched into space aboard SpaceX rocket\0"
+    "Amazon reportedly laying off hundreds of corporate employees\0"
+    "Bill Gates could no longer be world's richest if he paid off US debt\0"
+    "Bitcoin tumbles below $6,000 amid broader cryptocurrency selloff\0"
+    "Roku outperformed all other major technology stocks in 2017\0"
+    "Warren Buffett outlines 'terrible' mistake of not investing in Amazon\0"
+    "Ford ousts chief of North American operations amid misconduct probe\0"
+    "\0"
+
+    // Mar 2018
+    "Facebook stock plunges amid Cambridge Analytica data scandal\0"
+    "Uber exits Southeast Asia in new swap deal with Grab\0"
+    "Trump blocks Broadcom's $117 billion bid for Qualcomm on security grounds\0"
+    "Dropbox raises $756 million in biggest tech IPO of 2018 so far\0"
+    "Tesla says autopilot was active during fatal Model X crash\0"
+    "Amazon is now second most valuable US company, tops Alphabet\0"
+    "Alibaba develops car vending machine for buyers in China\0"
+    "YouTube tries to crack down on video creators for conspiracy theories\0"
+    "Volkswagen stored data on 3.3 million truck owners in unauthorized way\0"
+    "Trump ousts Secretary of State Rex Tillerson in another shakeup\0"
+    "\0"
+
+    // Apr 2018
+    "Facebook reveals data on 87 million users was improperly shared\0"
+    "Amazon tops 100 million Prime subscribers, pushing towards profitability\0"
+    "Uber welcomes Toyota as latest investor with $500 million stake\0"
+    "T-Mobile and Sprint restart merger talks after years of battling\0"
+    "Tesla struggles to meet Model 3 production goals, Musk details excessive toil\0"
+    "Apple reports strong earnings but warns of higher prices ahead\0"
+    "FAA orders inspection of 352 Boeing 737 engines after Southwest accident\0"
+    "Alibaba buys Pakistani e-commerce leader Daraz in latest play\0"
+    "YouTube targets conspiracy videos in widespread account purge\0"
+    "Twitter amps up efforts to crack down on toxic content, fake accounts\0"
+    "\0"
+
+    // May 2018
+    "Elon Musk says Tesla will fix production issues by reorganizing management\0"
+    "Uber unveils plans to launch food delivery drones by 2021\0"
+    "Warren Buffett criticizes bitcoin as nonproductive and illicit\0"
+    "Cambridge Analytica files for bankruptcy in US after Facebook data scandal\0"
+    "Amazon goes head-to-head with Tencent in Southeast Asian cloud war\0"
+    "Microsoft launches $25 million program to use AI for disabilities\0"
+    "Instagram launches video chat and new explore features\0"
+    "US and China put trade war on hold after talks in Washington\0"
+    "Tesla Autopilot update to include first 'full self-driving features'\0"
+    "Philip Morris gets approval to market alternative cigarette as less risky\0"
+    "\0"
+
+    // Jun 2018
+    "Tesla cuts 9 percent of workforce in quest to post profit\0"
+    "Disney raises bid for Fox assets to $71.3 billion, outflanking Comcast\0"
+    "Uber begins using artificial intelligence to detect drunk passengers\0"
+    "Microsoft employees revolt against working with US on 'cruel' deportations\0"
+    "EU hits Google with $5 billion antitrust fine over Android practices\0"
+    "Supreme Court rules states can collect internet sales tax\0"
+    "Amazon gains new online footing with $1 billion PillPack acquisition\0"
+    "Starbucks to accelerate US store closings next year\0"
+    "BlackBerry bids $1.4 billion for cybersecurity firm Cylance\0"
+    "Slack staff cracks down on hate speech by racist tech fraternity members\0"
+    "\0"
+
+    // Jul 2018
+    "Broadcom agrees to acquire software company CA Technologies for $18.9 billion\0"
+    "Netflix shares take hit as subscriber slip hints at 'hubris' problem\0"
+    "Amazon Prime Day becomes an internet traffic nightmare\0"
+    "Microsoft secures $4.6 billion contract to supply US army with AR headsets\0"
+    "Elon Musk faces backlash after insulting Thai cave rescue diver\0"
+    "Comcast outbids Fox in $39 billion battle for Sky TV in Britain\0"
+    "Facebook hit with first fine in Cambridge Analytica data leak scandal\0"
+    "Tesla achieves Model 3 production goals, but cuts costs remain\0"
+    "Twitter purges more locked accounts from follower counts\0"
+    "Uber gets approval to put self-driving cars on roads again\0"
+    "\0"
+
+    // Aug 2018
+    "Tesla CEO Elon Musk considers taking company private, faces SEC scrutiny\0"
+    "Apple hits $1 trillion market cap before sliding back\0"
+    "Alibaba's quarterly revenue surges 61 percent amid e-commerce boom\0"
+    "MoviePass slashes access to block availability amid cash crisis\0"
+    "Uber narrows losses but growth slows amid cash burn\0"
+    "Twitter CEO commits to fixing toxic content after racist attack\0"
+    "Microsoft soars past $800 billion in market value for the first time\0"
+    "Google staff protest over censored China search engine 'Dragonfly'\0"
+    "Coca-Cola to buy UK coffee chain Costa for $5.1 billion\0"
+    "Amazon joins $1 trillion club, becomes second company after Apple\0"
+    "\0"
+
+    // Sep 2018
+    "Amazon becomes the second $1 trillion company in the U.S\0"
+    "Tesla says it will remain a public company after Musk's controversial tweet\0"
+    "Apple unveils iPhone XS, XS Max and lower-cost XR models\0"
+    "Ticketmaster recruits ethicists to review its business practices\0"
+    "Alibaba's Jack Ma to step down as chairman in September 2019\0"
+    "Uber agrees to pay $148 million over allegation of data breach coverup\0"
+    "Walmart opens first e-commerce distribution center to take on Amazon\0"
+    "Spotify announces it will now work with Alexa and Amazon devices\0"
+    "Uber driver pay data for 92 million drivers exposed in hack\0"
+    "Google staff discussed tweaking search results to counter travel ban\0"
+    "\0"
+
+    // Oct 2018
+    "Saudi Arabia invites global investors to participate in IPO of Aramco\0"
+    "Tesla launches new $45,000 Model 3 sedan for the masses\0"
+    "Facebook security breach exposes 50 million user accounts\0"
+    "Canada follows Uruguay in legalizing recreational marijuana nationwide\0"
+    "Amazon launches first AI hybrid online/physical shopping experience\0"
+    "SoftBank's massive $100 billion Vision Fund struggles on some bets\0"
+    "Microsoft co-founder Paul Allen dies at 65 after battle with cancer\0"
+    "Google unveils new Pixel 3 phones, Home Hub and AI computer titles\0"
+    "Elon Musk says first tunnel for LA 'disturbingly long' underground bus route almost done\0"
+    "Uber IPO could put company value at $120 billion, sources say\0"
+    "\0"
+
+    // Nov 2018
+    "Amazon picks New York City and Virginia for $5 billion new headquarters\0"
+    "Walmart beats Amazon's online prices for the first time, study shows\0"
+    "Microsoft overtakes Apple as the most valuable US company\0"
+    "Facebook CEO Mark Zuckerberg rejects criticism over handling of scandals\0"
+    "Uber reports $1 billion loss as comeback from scandals proves painful\0"
+    "Disney set to gain ground with newly approved Fox deal\0"
+    "Elon Musk's Boring Company scraps plans for LA Westside tunnel\0"
+    "Bitcoin sinks below $5,000, half its 2018 peak of near $20,000\0"
+    "Juul halts store sales of some flavored e-cigarette pods amid outcry\0"
+    "GM to lay off up to 14,000 factory and white-collar workers\0"
+    "\0"
+
+    // Dec 2018
+    "Dow suffers worst Christmas Eve massacre, dropping 653 points\0"
+    "Apple shares drop 7% after warning of weak holiday iPhone sales\0"
+    "Jeff and MacKenzie Bezos announce plans to divorce after 25 years\0"
+    "Dow caps off worst year since 2008 financial crisis amid trade tensions\0"
+    "Tesla misses Model 3 delivery targets yet again, stock plunges\0"
+    "Amazon issues no-fee salary advance amid worker cash crisis\0"
+    "Ford recalls 874,000 F-Series pickup trucks for fire risks\0"
+    "Wells Fargo agrees to $575 million settlement over improper practices\0"
+    "SpaceX raises $500 million from investors as internet satellite production ramps\0"
+    "Facebook refutes claims of sharing user data without permission\0"
+    "\0"
+
+    // Jan 2019
+    "Apple issues rare revenue warning citing weak China sales\0"
+    "Stocks suffer worst December since the Great Depression\0"
+    "PG&E files for bankruptcy amid wildfire lawsuits and billions in liabilities\0"
+    "Billionaire Jeff Bezos announces divorce from wife MacKenzie after 25 years\0"
+    "Huawei employee arrested in Poland over spying allegations\0"
+    "Tesla misses Model 3 delivery targets again, cuts prices\0"
+    "Snap employees fear being left behind in US government shutdown\0"
+    "Netflix raises subscription prices to fund new content\0"
+    "World Bank issues warning over global 'storm' of debt\0"
+    "Cryptocurrency bitcoin drops below $3,500, down 80% from highs\0"
+    "\0"
+
+    // Feb 2019
+    "Amazon scraps plans to build headquarters in New York City\0"
+    "Tesla loses $700 million after another difficult year\0"
+    "Payless ShoeSource to close all remaining US stores\0"
+    "Kraft Heinz discloses $15 billion writedown, SEC investigation\0"
+    "Honda to shutdown UK plant in latest Brexit blow\0"
+    "Samsung unveils foldable phone, the Galaxy Fold\0"
+    "Elon Musk's security clearance under review over marijuana use\0"
+    "Fiat Chrysler to pay $700 million for emissions cheating\0"
+    "SpaceX launches triple core rocket and crew capsule\0"
+    "Warren Buffett says Kraft Heinz problems are 'my fault'\0"
+    "\0"
+
+    // Mar 2019
+    "Apple launches news.text subscription app Apple News+ for $9.99 a month\0"
+    "Lyft kicks off investor road show for IPO expected to value it at $23bn\0"
+    "Facebook suffers its worst outage in over a decade\0"
+    "Pinterest joins rush of tech companies planning 2019 IPOs\0"
+    "Cruise ship company Virgin Voyages turns to Boeing 737 crashes\0"
+    "FAA grounds Boeing 737 Max planes after fatal Ethiopia crash\0"
+    "Bayer's $63 billion Monsanto takeover upended by Roundup cancer ruling\0"
+    "Facebook faced criminal investigation for data sharing deals\0"
+    "Volkswagen CEO apologizes after evoking Nazi slogan 'Arbeit macht frei'\0"
+    "Levi Strauss valued at $6.6 billion for iconic jeans maker's return to markets\0"
+    "\0"
+
+    // Apr 2019
+    "Uber reveals IPO terms that could value company at up to $84 billion\0"
+    "Pinterest valued at $12.7 billion after IPO, rallies in market debut\0"
+    "Samsung retrieving all Galaxy Fold samples after defective screens\0"
+    "Tesla says investigating incident of car catching fire in Shanghai\0"
+    "Amazon to pull plug on China domestic e-commerce business\0"
+    "Boeing says it knew about 737 Max sensor problem before crashes\0"
+    "Elon Musk, SEC go to court over his Tesla tweets\0"
+    "Microsoft hits $1 trillion market cap after reporting strong earnings\0"
+    "Disney unveils $6.99 streaming bundle with Hulu, ESPN+ for Netflix attack\0"
+    "Anadarko Petroleum rejects Occidental's $38 billion offer\0"
+    "\0"
+
+    // May 2019
+    "Uber bumps up its IPO pricing to raise $8.1 billion\0"
+    "Trump increases tariffs on $200 billion of Chinese goods to 25%\0"
+    "Huawei hit by US export controls, potential import ban\0"
+    "Uber begins trading at $42 per share in anticipated IPO\0"
+    "Fiat Chrysler proposes merger with Renault to create auto giant\0"
+    "GameStop shares plunge 36% as console sales miss estimates\0"
+    "Amazon shareholders reject motion to ban facial recognition sales\0"
+    "Tesla stock and bonds tumble after Musk's 'Eferesced' tweet for beer\0"
+    "Facebook takes step to integrate apps for encrypted messaging\0"
+    "Avengers: Endgame kicks off a huge summer for Disney\0"
+    "\0"
+
+    // Jun 2019
+    "Uber loses $1 billion in Q1 as revenue growth slows\0"
+    "YouTube updates hate speech policies to prohibit 'supremacist' videos\0"
+    "Target summons unicorn magic amid turnaround with share price at record high\0"
+    "Apple faces triple threat as Iran revokes developer licenses\0"
+    "ByteDance, TikTok's parent, is Apple's newest threat with addictive apps\0"
+    "Hackers steal over $40 million worth of Bitcoin from Binance exchange\0"
+    "Microsoft pulls Huawei laptop after adding it overnight\0"
+    "Amazon's Jeff Bezos wants to spend 'Lord of the Rings' money on space\0"
+    "FedEx no longer will fly your Amazon packages on express plane\0"
+    "Tesla CEO Elon Musk earned a compensation of exactly $2.3 billion last year\0"
+    "\0"
+
+    // Jul 2019
+    "Facebook hit with $5 billion privacy violation fine by FTC\0"
+    "Amazon workers strike as 'Prime' shopping frenzy hits\0"
+    "Capital One data breach hits about 100 million people\0"
+    "Samsung's folding phone, the Galaxy Fold, finally goes on sale\0"
+    "Equifax's $700 million data breach settlement spurs criticism\0"
+    "Twitter shares fall as hacking claims account for slowing user growth\0"
+    "Apple beats profit estimates amid declining iPhone sales\0"
+    "FaceApp mystery man's digital 'robacle' provides AI wake up call\0"
+    "James Paterek sued by Elon Musk after calling him a 'pedo guy'\0"
+    "Trump administration takes action against France for tech tax\0"
+    "\0"
+
+    // Aug 2019
+    "Apple's credit card being launched in partnership with Goldman Sachs\0"
+    "Disney emerges as winner of Fox entertainment assets after Comcast drops bid\0"
+    "Global economic growth is 'fragile', says former Fed Chair Janet Yellen\0"
+    "Google staff demand company issues climate plan amid worker departures\0"
+    "Overstock CEO resigns after 'deep state' comments cause investor revolt\0"
+    "Billionaire David Koch, conservative donor, dies at age 79\0"
+    "Twitter, Facebook accuse China of harboring Hong Kong disinformation campaign\0"
+    "Nasdaq confirms its systems were knocked offline by data center issue\0"
+    "GM workers call for strike amid contract negotiations at UAW\0"
+    "Sony buys 'Spider-Man' video game developer Insomniac Games\0"
+    "\0"
+
+    // Sep 2019
+    "WeWork postpones IPO after investors question value and corporate governance\0"
+    "Saudi Aramco gives green light for world's biggest IPO\0"
+    "General Motors workers in U.S. go on nationwide strike\0"
+    "Uber makes biggest labor deal by giving 70,000 drivers in Canada union membership\0"
+    "Google wins legal battle over hugely profitable Android mobile operating system\0"
+    "Amazon's Alexa will start giving medical advice from the NHS website\0"
+    "Huawei founder says he wouldn't protest if daughter Meng were freed\0"
+    "Fed lowers rates again amid slowing growth but signals potential pause\0"
+    "Tesla's Model 3 earns top safety rating from IIHS\0"
+    "Anheuser-Busch accuses MillerCoors of stealing secret recipes\0"
+    "\0"
+
+    // Oct 2019
+    "Mark Zuckerberg defends Facebook's policies amid criticism and protests\0"
+    "WeWork accepts SoftBank takeover that will oust founder Adam Neumann\0"
+    "California hits Uber and Lyft with gig economy labor law\0"
+    "Boeing aims to resume 737 MAX production by early 2020\0"
+    "SoftBank to take control of WeWork with nearly $10 billion rescue payday\0"
+    "Biogen's shocking Alzheimer's data blew away expectations, vaulting stock 26%\0"
+    "Apple says streaming TV service Apple TV Plus will be $4.99 per month\0"
+    "FAA panel says Boeing 737 MAX software is 'operationally suitable'\0"
+    "Johnson & Johnson agrees to settle Ohio opioid lawsuits for $20.4 million\0"
+    "McDonald's CEO fired for consensual relationship with employee\0"
+    "\0"
+
+    // Nov 2019
+    "Uber loses $1.2 billion in one quarter as growth slows\0"
+    "Disney+ streaming service hits 10 million subscribers on first day\0"
+    "Google partners with health firm to secretly gather millions of patient records\0"
+    "Bill Gates overtakes Jeff Bezos as world's richest person\0"
+    "Tesla unveils its electric 'Cybertruck' pickup amid doubts\0"
+    "Amazon fights Microsoft's $10 billion 'war cloud' deal with protest\0"
+    "Apple co-founder Steve Wozniak joins legal battle against YouTube ripper\0"
+    "China receives 37 aircraft from Boeing following trade truce with US\0"
+    "Alibaba smashes sales records on Singles Day amid Hong Kong protests\0"
+    "Uber says it'll pratice truth on TV: mileage, emissions impact\0"
+    "\0"
+
+    // Dec 2019
+    "Saudi Aramco's record IPO raises $25.6 billion, hitting top of range\0"
+    "Uber receives approval to test self-driving cars on California roads\0"
+    "New law signed by Trump could allow US to monitor Huawei equipment\0"
+    "Boeing fires CEO Dennis Muilenburg amid 737 MAX crisis\0"
+    "Amazon blaming 'technical issue' for removing some employee criticism\0"
+    "Nike ousts Amazon to become most valuable apparel company\0"
+    "Facebook agrees to pay $550 million to end Illinois facial recognition lawsuit\0"
+    "Elon Musk wins defamation trial over 'pedo guy' insult\0"
+    "Tesla moving ahead with using in-car video fromDriverCam\0"
+    "Google founders Larry Page and Sergey Brin resign as Alphabet leaders\0"
+    "\0"
+
+    // Jan 2020
+    "US stocks suffer worst day in a month on coronavirus fears\0"
+    "Boeing's 737 MAX crisis deepens as production stops for first time\0"
+    "Tesla's stock rockets higher, leaving 'smart money' investors bewildered\0"
+    "Microsoft looks to outsource more video game work\0"
+    "Jeff Bezos net worth hits $109 billion after successful holiday season\0"
+    "International panel faults Boeing and FAA over 737 MAX crisis\0"
+    "Google parent company Alphabet joins $1 trillion market cap club\0"
+    "McDonald's rolls out two new crispy chicken sandwiches nationwide\0"
+    "Grounded 737 MAX cancellations make Boeing's first 2020 loss likely\0"
+    "Jeff Bezos iPhone X breach increases pressure on Saudi Arabia\0"
+    "\0"
+
+    // Feb 2020
+    "Dow plunges over 1,000 points amid coronavirus fears\0"
+    "T-Mobile and Sprint merger approved by federal judge\0"
+    "Coronavirus disrupts Apple's manufacturing schedule in China\0"
+    "Facebook to pay $550 million over Illinois privacy violation suit\0"
+    "Apple warns of quarterly revenue shortfall due to coronavirus impact\0"
+    "ViacomCBS begins trading after Viacom, CBS merger completed\0"
+    "Tesla becomes world's most valuable automaker amid stock rally\0"
+    "Amazon files protest as Microsoft wins $10 billion Pentagon contract\0"
+    "Coronavirus declared global health emergency by WHO\0"
+    "Jeff Bezos launches $10 billion fund to fight climate change\0"
+    "\0"
+
+    // Mar 2020
+    "Stocks enter bear market as coronavirus pandemic devastates economy\0"
+    "Biden and Sanders cancel rallies as coronavirus upends 2020 race\0"
+    "NBA suspends season amid coronavirus outbreak after player tests positive\0"
+    "Apple reopens all stores outside of coronavirus hotspot China\0"
+    "NYSE to temporarily close iconic trading floor amid COVID-19 outbreak\0"
+    "Fed slashes interest rates to near zero to support US economy\0"
+    "US airlines seek over $50 billion in federal aid amid coronavirus crisis\0"
+    "Amazon struggles with mass homebound shopping demand amid COVID-19\0"
+    "Uber, Lyft drivers promised sick pay if they have COVID-19\0"
+    "Tesla Fremont factory remains open despite shelter-in-place order\0"
+    "\0"
+
+    // Apr 2020
+    "Coronavirus leaves millions of Americans without jobs, income\0"
+    "Oil prices turn negative as coronavirus obliterates demand\0"
+    "Google launches nationwide COVID-19 community mobility reports\0"
+    "Amazon fired worker who led strike for time off, higher pay amid COVID-19\0"
+    "Zoom is now worth more than the world's 7 biggest airlines combined\0"
+    "AMC Theatres says it has enough cash to reopen this summer as theaters go dark\0"
+    "Airbnb raising $1 billion amid COVID-19 disruption to travel business\0"
+    "Apple and Google team up for COVID-19 contact tracing technology\0"
+    "Ford, GE plan to produce 50,000 ventilators in 100 days\0"
+    "Twitter employees can work from home 'forever' if they wish\0"
+    "\0"
+
+    // May 2020
+    "Uber cuts 3,700 jobs as pandemic shuts down ride-sharing business\0"
+    "Jeff Bezos could become world's first trillionaire by 2026 at current rate\0"
+    "Hertz files for bankruptcy amid pandemic rental car crisis\0"
+    "SpaceX's historic astronaut launch kicked off new era of spaceflight\0"
+    "Elon Musk defies orders, reopens Tesla plant in California\0"
+    "JCPenney Files for Bankruptcy as COVID-19 Pushes Retail Chain Over Edge\0"
+    "Zuckerberg says Facebook staff can work from anywhere for the next decade\0"
+    "EU lays out $824B coronavirus pandemic aid plan 'befitting' crisis\0"
+    "Amazon expects to spend all $4 billion earned in Q2 on COVID-19 costs\0"
+    "Sony reportedly entering billion-dollar deal to acquire Warzone developer\0"
+    "\0"
+
+    // Jun 2020
+    "Coronavirus recession ends after 3 months, making it shortest on record\0"
+    "PepsiCo to rebrand Aunt Jemima products, remove logo over racist origins\0"
+    "Amazon buying self-driving startup Zoox for $1.2 billion\0"
+    "McDonald's faces racial discrimination lawsuit from former franchisees\0"
+    "Amazon aims to hire 33,000 people as demand continues surging\0"
+    "Samsung plans to discontinue its premium Galaxy Note smartphones\0"
+    "Google makes WFH permanent, gives workers $1,000 allowance to outfit home offices\0"
+    "Tesla hits goal of 500,000 vehicle deliveries in 2020 two years early\0"
+    "Spotify touts podcast gains, Disney partnership as COVID-19 weighs on ad revenue\0"
+    "Apple pays $175 million for violating patent on ebooks purchased via apps\0"
+    "\0"
+
+    // Jul 2020
+    "Apple becomes first US company to reach $2 trillion market value\0"
+    "SpaceX wins NASA contract to build spacecraft for future Artemis moon mission\0"
+    "Uber buys Postmates for $2.65 billion in all-stock deal\0"
+    "US tech giants testify before Congress in historic antitrust hearing\0"
+    "NASA launches new Perseverance Mars rover from Florida's Cape Canaveral\0"
+    "Samsung unveils the Galaxy Z Fold2 with improved foldable screen\0"
+    "Twitter hit with large hack targeting Biden, Obama, Musk and others\0"
+    "UK bans Huawei from its 5G network, angering China and pleasing Trump\0"
+    "Philip Morris wins dismissal of $109 million patent case against Swisher\0"
+    "Microsoft to keep working from home until at least January 2021\0"
+    "\0"
+
+    // Aug 2020
+    "Apple becomes first US public company to hit $2 trillion market cap\0"
+    "Big US companies form union to acquire Covid-19 testing capabilities\0"
+    "US deficit climbed to $2.8 trillion in first 10 months of 2020\0"
+    "Epic Games sues Apple and Google after Fortnite is kicked off app stores\0"
+    "Derek Jeter's startup raises $125 million and continues building Yankees brand\0"
+    "FAA outlines rules for Boeing to certify 737 MAX fixes\0"
+    "FedEx overcharged businesses $21.5 million for years, audit shows\0"
+    "US senators revolt after Trump picks Louis DeJoy as postmaster general\0"
+    "OpenText acquires cloud security firm Carbonite for $1.42 billion\0"
+    "EU slams Apple for corporate tax shenanigans in Ireland, hits with $14.9B bill\0"
+    "\0"
+
+    // Sep 2020
+    "Tesla stages massive 'Battery Day' rally after stock split takes effect\0"
+    "UK to challenge Nvidia's $40 billion ARM acquisition over security risks\0"
+    "Fortune reports the 600 richest people saw $637B increase in 2020\0"
+    "Chewy stock pops after retailer reports $3.1 billion in quarterly sales\0"
+    "Microsoft to acquire video game company Bethesda for $7.5 billion\0"
+    "TikTok asks US court to intervene as deadline for sale nears\0"
+    "Oracle beats Microsoft in deal to buy TikTok's US business operations\0"
+    "Nikola founder Trevor Milton resigns amid fraud allegations\0"
+    "Amazon bans foreign seed sales in US after mysterious packages arrive\0"
+    "Walmart takes ownership stake in TikTok Global as Oracle deal is finalized\0"
+    "\0"
+
+    // Oct 2020
+    "Ant Group IPO pricing puts value at $316B, set for largest offering ever\0"
+    "Google to pay $1 billion to publishers over three years for news content\0"
+    "Regeneron antibody drug reduces virus levels in non-hospitalized patients\0"
+    "iPhone 12 and 5G wireless networks could boost economic growth, says analyst\0"
+    "DOJ approves $16 billion MWAA utility sale, despite opposition from Congress\0"
+    "Beyond Meat strikes Walmart, Target sushi deals, plots future steak release\0"
+    "Apple unveils first over-ear headphones and smaller HomePod mini speaker\0"
+    "Facebook accused of censorship amid complicated fact-checking partnerships\0"
+    "Toyota recalling up to 5.84 million vehicles for defective fuel pumps\0"
+    "SpaceX's Crew-1 astronaut launch marks the beginning of a new era\0"
+    "\0"
+
+    // Nov 2020
+    "Dow crosses 30,000 for first time as investors cheer Trump exit, Biden win\0"
+    "Elon Musk overtakes Bill Gates to become world's second richest man\0"
+    "Airbnb aims for $35 billion IPO valuation in expectation-defying debut\0"
+    "DoorDash launches IPO after COVID-19 delivery boom, valued at $32 billion\0"
+    "Slack sold to Salesforce for $27.7 billion in cloud computing's latest megadeal\0"
+    "Warner Bros. to stream all 2021 movies on HBO Max on same day as theaters\0"
+    "Tesla to be added to S&P 500, sparking epic stock rally\0"
+    "Former Zappos CEO Tony Hsieh died from smoke inhalation in house fire\0"
+    "Elon Musk says he has moved from California to Texas, criticizing Silicon Valley\0"
+    "Black Friday online shopping hits new record as pandemic upends holiday season\0"
+    "\0"
+
+    // Dec 2020
+    "Facebook faces antitrust lawsuit from Federal Trade Commission and 48 states\0"
+    "Airbnb IPO pricing at $68 per share, valuing company at $47 billion\0"
+    "AWS outage causes major issues for Roku, Flickr, Philadelphia's court system\0"
+    "Alibaba hit with antitrust probe, sending its shares and chips makers' tumbling\0"
+    "Bitcoin prices hit new high above $25,000 amid rising institutional interest\0"
+    "Kodak loan deal halted by federal court amid allegations of misconduct\0"
+    "SolarWinds faces SEC investigation after massive hack of US government agencies\0"
+    "Spotify unveils 2020 wrapped with Bad Bunny as most-streamed global artist\0"
+    "Apple targets car production by 2024 and eyes 'next level' battery technology\0"
+    "Elon Musk says it's 'impossible' to take Tesla private, denies reports\0"
+    "\0"
+
+    // Jan 2021
+    "Tesla's market value tops $800 billion for the first time\0"
+    "Reddit Day Traders wage battle against Wall Street over GameStop stock\0"
+    "Jeff Bezos to step down as Amazon CEO, Andy Jassy to take over\0"
+    "Robinhood app sued for restricting trading amid GameStop frenzy\0"
+    "Bitcoin drops over 10% after hitting record high near $42,000\0"
+    "Intel ousts CEO Bob Swan after seven turbulent quarters\0"
+    "Larry King, legendary TV interviewer, dies at 87\0"
+    "Boeing 737 Max aircraft ungrounded in US after 20-month halt\0"
+    "Hyundai and Boston Dynamics reveal new factory safety robot\0"
+    "Amazon sues e-commerce consultant over insider trading claims\0"
+    "\0"
+
+    // Feb 2021
+    "GameStop shares surge over 100% amid buying frenzy\0"
+    "Jeff Bezos announces 'success and revolution' in his final letter as Amazon CEO\0"
+    "Elon Musk loses spot as world's richest person to Jeff Bezos\0"
+    "Ted Cruz takes heat for Cancun trip amid Texas storm crisis\0"
+    "Volkswagen to reboot 'Scout' brand in US with electric trucks and SUVs\0"
+    "Google fires another leading AI ethics researcher amid tensions\0"
+    "Boeing recommits to twin-aisle jets amid airshow drought\0"
+    "Huawei unveils high-end Mate X2 foldable smartphone\0"
+    "Texas sues Griddy, electric utility behind $9,000+ bills amid freeze crisis\0"
+    "Ford recalls 3 million vehicles over air bag defect linked to 6 deaths\0"
+    "\0"
+
+    // Mar 2021
+    "Archegos Capital meltdown starts fire sale of $30 billion in stocks\0"
+    "Tesla's market value tops $650 billion amid tech stock selloff\0"
+    "Massive cargo ship blocks Egypt's Suez Canal for nearly a week\0"
+    "Microsoft reportedly in talks to acquire Discord for over $10 billion\0"
+    "Billionaire Mike Novogratz blasts mask 'passport' madness in rant\0"
+    "Nike exec resigns after reports of an undisclosed relationship\0"
+    "Cruise company debt swells to $50+ billion amid Covid-19 catastrophe\0"
+    "Volkswagen says it's not too late to become global EV leader despite Tesla\0"
+    "Amazon workers in Alabama get a do-over on unionization vote\0"
+    "Robinhood confidentially files to go public after GameStop saga\0"
+    "\0"
+
+    // Apr 2021
+    "Global chip shortage forces automakers to cut production\0"
+    "Amazon defeats union push at Alabama warehouse in major win\0"
+    "Facebook data on 533 million users reemerges after years underground\0"
+    "Goldman Sachs begins trading digital assets as prices surge\0"
+    "Microsoft wins $22 billion contract making augmented reality headsets for US Army\0"
+    "Coinbase goes public at $86 billion valuation in crypto's biggest listing\0"
+    "Jeff Bezos' Blue Origin launches NASA's New Shepard rocket on a test flight\0"
+    "Google claims big leap forward in blazingly fast computing with new chip\0"
+    "Founders Fund backs $19M Series A for Autonomy's Tesla EV subscription service\0"
+    "SpaceX Crew-2 launches new crew for six-month stay on International Space Station\0"
+    "\0"
+
+    // May 2021
+    "Bill Gates and Melinda Gates announce divorce after 27 years of marriage\0"
+    "Elon Musk's SpaceX launches rocket with global internet array\0"
+    "AT&T announces $43 billion deal to merge WarnerMedia with Discovery\0"
+    "Amazon wins legal battle over $10 billion Pentagon cloud computing contract\0"
+    "Tesla no longer accepts Bitcoin for purchases, citing environmental concerns\0"
+    "Colonial Pipeline restarts operations after crippling cyber attack\0"
+    "Amazon to hire 75,000 workers across US amid housing crunch near warehouses\0"
+    "Elon Musk trolls Bitcoin again, meme-inspired dogecoin leaps\0"
+    "Warren Buffett slams Bitcoin again at Berkshire Hathaway meeting\0"
+    "JPMorgan's BlockChain payments platform gets first Singapore bank\0"
+    "\0"
+
+    // Jun 2021
+    "El Salvador becomes first country to adopt Bitcoin as legal tender\0"
+    "Microsoft announces Windows 11, first major software upgrade in 6 years\0"
+    "China launches spacecraft in historic mission to Mars\0"
+    "Jeff Bezos' Blue Origin to auction off seat on first human spaceflight\0"
+    "Lordstown Motors execs resign amid disruptions as electric truck launch delayed\0"
+    "Krispy Kreme IPO prices at $17 a share, valuing doughnut chain at $2.7 billion\0"
+    "WeWork starts trading after SPAC merger values it at $9 billion\0"
+    "John McAfee, antivirus software pioneer, found dead in Spanish prison\0"
+    "Supreme Court sides with Facebook in data mining privacy case\0"
+    "Trump's blog closed down a month after launch amid 21st century 'glitch'\0"
+    "\0"
+
+    // Jul 2021
+    "Richard Branson beats Jeff Bezos to space in Virgin Galactic flight\0"
+    "Jeff Bezos' Blue Origin completes first crewed space flight\0"
+    "Elon Musk cites data digging effort behind delay in Tesla's India entry\0"
+    "GM recalling Chevy Bolt EVs again for battery fire risks with $1B impact\0"
+    "Robinhood IPO stock prices at $38 per share in $32 billion Nasdaq debut\0"
+    "Google delays return-to-office plan amid surge in COVID cases\0"
+    "China opens cyberspace administration amid tech crackdown\0"
+    "Blue Origin employees blast leaders after Bezos spaceflight\0"
+    "Pfizer in $3.2 billion cash deal to help develop new Sanofi vaccines\0"
+    "Jeff Bezos offers to cover $2 billion in NASA costs in exchange for contract\0"
+    "\0"
+
+    // Aug 2021
+    "Facebook rebrands its Workplace software as Meta\0"
+    "Bill Gates admits affairs with employees, as Microsoft investigates\0"
+    "U.S. gives Huawei a temporary reprieve on some licenses\0"
+    "Uber sees revenue in ride-hailing business finally top pre-pandemic levels\0"
+    "YouTubers spark backlash for traveling to Pakistan's 'Hingol' national park\0"
+    "Walmart assembles SpaceX rideshare satellite with focus on rural internet\0"
+    "Amazon to hire 55,000 tech and corporate employees\0"
+    "Intel seeks $10 billion in subsidies for a planned Ohio semiconductor plant\0"
+    "Fed Chair Jerome Powell signals start of tapering bond purchases this year\0"
+    "Computer chip shortage grounds American Airlines flights, exacerbates chip woes\0"
+    "\0"
+
+    // Sep 2021
+    "El Salvador's Bitcoin digital wallet 'Chivo' sees bumpy rollout\0"
+    "SpaceX's all-civilian crew returns from three-day orbital mission\0"
+    "Startups race to develop human coronavirus challenge trials\0"
+    "Toyota to slash production by 40% amid chip shortage\0"
+    "Hyundai to launch dedicated EV brand IONIQ in major EV push\0"
+    "Trump in talks to launch media company after Facebook ban upheld\0"
+    "Tesla drivers can now request Full Self-Driving software\0"
+    "Russia antitrust agency fines Google over Play Store fees\0"
+    "Theranos founder Elizabeth Holmes's criminal fraud trial begins\0"
+    "Evergrande, China's beleaguered real estate colossus, inches toward default\0"
+    "\0"
+
+    // Oct 2021
+    "Facebook whistleblower testifies about company's algorithms 'tearing our societies apart'\0"
+    "Elon Musk becomes first person on Earth worth over $300 billion\0"
+    "JPMorgan kicks off Bitcoin fund for institutional clients as crypto acceptance grows\0"
+    "Facebook announces plans to hire 10,000 in EU to build its 'metaverse'\0"
+    "Tesla earns $1 billion profit for the first time riding electric vehicle sales\0"
+    "Amazon faces fines, increasing concerns from Black managers over racial inequities\0"
+    "Microsoft agrees to never again use 'abusive, restrictive' tactics after Activision deal\0"
+    "Chinese property giant Evergrande misses $84 million interest payment\0"
+    "Apple unveils AirPods 3 with shorter stems, Spatial Audio and more battery life\0"
+    "Elon Musk's Tesla hits $1 trillion valuation after Hertz's blockbuster EV order\0"
+    "\0"
+
+    // Nov 2021
+    "Elon Musk sells $5 billion worth of Tesla shares amid Twitter poll\0"
+    "Rivian, electric truck maker, raises $11.9 billion in blockbuster IPO\0"
+    "Biden signs infrastructure bill directing $1T toward broadband, electric vehicles\0"
+    "Roblox revenue soars as gaming platform draws over 50 million daily users\0"
+    "Musk tweets he's considering spinoff of Tesla's solar energy business\0"
+    "Amazon ripped over 'code name' criticism for Black Lives Matter protest\0"
+    "Americans quit their jobs at a record pace in September amid COVID chaos\0"
+    "Baidu unveils metaverse concept car without a steering wheel\0"
+    "NBCUniversal sells $3.6 billion of ad inventory in cryptic digital currency 'Kreds'\0"
+    "Elizabeth Holmes testifies that Theranos founder was raped on Stanford campus\0"
+    "\0"
+
+    // Dec 2021
+    "Elon Musk officially crowned world's richest person after Tesla's value hits $1 trillion\0"
+    "SpaceX could spin off Starlink in several years and take it public, Musk says\0"
+    "Apple lets iPhone users get Covid pass through revised system\0"
+    "Roblox and National Football League to create metaverse experience\0"
+    "Toyota overtakes GM to become top-selling automaker in the US\0"
+    "Apple hits lawsuit over iPhone throttling, agrees to pay users $113M settlement\0"
+    "SEC charges crypto lender BlockFi with outright violation of securities law\0"
+    "Months after sexual assault allegations, Riot paid its CEO $8 million\0"
+    "Jack Dorsey steps down from Twitter as CEO, Parag Agrawal takes over\0"
+    "US lawmakers increase pressure on big tech firms to tackle undercompensation\0"
+    "\0"
+
+    // Jan 2022
+    "Microsoft to acquire video game giant Activision Blizzard for $68.7 billion\0"
+    "Airlines cancel thousands of flights amid COVID-19 staffing shortages\0"
+    "NFT sales hit $25 billion in 2021 as craze turns into bubble\0"
+    "Intel to invest $20 billion in new chip factories in Ohio\0"
+    "Peloton's stock crashes 25% after dismal production outlook\0"
+    "AMD agrees to buy Xilinx for $35 billion in a chipmaking megamerger\0"
+    "General Motors launches new $1.3 billion electric vehicle plant in Mexico\0"
+    "U.S. FAA clears 62% of U.S. commercial airplane fleet after 5G deployments\0"
+    "Bitcoin falls by half from November record as crypto selloff worsens\0"
+    "Google loses bid to toss out DOJ's big antitrust case over ad empire\0"
+    "\0"
+
+    // Feb 2022
+    "Meta tanks 26% in one day, erasing over $200 billion in market value\0"
+    "US hits Huawei with new criminal charges over alleged trade secret theft\0"
+    "Apple's market cap briefly tops $3 trillion, then slips back down\0"
+    "Amazon raises Prime prices for US members by $20, first hike since 2018\0"
+    "SpaceX launches 49 satellites for its Starlink internet service\0"
+    "Twitter announces sale to Elon Musk for $44 billion\0"
+    "Shell exits Russia in one of biggest sovereign exits yet over Ukraine invasion\0"
+    "GM to sell new Chevy Silverado electric pickup with ultium batteries\0"
+    "Peloton to fire 2,800 employees, replace CEO as demand falls\0"
+    "Saudi Aramco overtakes Apple as world's most valuable company\0"
+    "\0"
+
+    // Mar 2022
+    "Musk says Twitter legal battle could head to trial over spam bot accounts\0"
+    "Amazon workers vote to join first U.S. union in historic labor win\0"
+    "Biden administration demands TikTok's Chinese owners sell stakes or face US ban\0"
+    "Netflix shares fall over loss of 200,000 subscribers amid stalled growth\0"
+    "Tesla opens Gigafactory in Berlin amid supply chain headwinds\0"
+    "Intel announces $88 billion Ohio semiconductor factory amid global shortage\0"
+    "Amazon union heads to second election at New York warehouse\0"
+    "Uber drivers across U.S. go on 24-hour strike to protest low pay\0"
+    "Apple supplier Foxconn resumes some operations at China plant amid COVID lockdown\0"
+    "Russia faces deepening economic crisis as sanctions take hold\0"
+    "\0"
+
+    // Apr 2022
+    "Musk secures $46.5 billion in funding to buy Twitter, traders cheer\0"
+    "Russia edges closer to historic debt default as payment period lapses\0"
+    "Elon Musk secures $7 billion in funding for his $44 billion Twitter bid\0"
+    "Jeff Bezos blasts Biden in latest tangle over inflation blame\0"
+    "Amazon workers in second NYC facility vote to unionize\0"
+    "Twitter accepts Elon Musk's $44 billion buyout deal\0"
+    "Google's Russian branch plans to file for bankruptcy after ad sales suspended\0"
+    "Boeing loses $1.1 billion on impacts of war, slower 787 production\0"
+    "Starbucks announces it's leaving Russia after 15 years\0"
+    "YouTube tests ultra-expensive ad packages for streaming TV shows\0"
+    "\0"
+
+    // May 2022
+    "Cryptocurrency markets in turmoil as stablecoin TerraUSD plunges\0"
+    "Musk says $44 billion Twitter deal 'temporarily on hold'\0"
+    "McDonald's to sell Russian business after over 30 years\0"
+    "YouTube to make billion-dollar investment in India's Bharti Airtel\0"
+    "Redbox agrees to entertainment company rebrand and go public\0"
+    "Elon Musk sued by Twitter investors for delaying disclosure of stake\0"
+    "Microsoft set to become third US tech firm worth over $2 trillion\0"
+    "Instagram tests new age verification methods for youth safety\0"
+    "Subway's $9.9 billion sale to private equity firm clears final hurdle\0"
+    "Grindr goes public via $2.1 billion SPAC deal to expand dating app business\0"
+    "\0"
+
+    // Jun 2022
+    "Tesla lays off 10% of salaried workers amid 'super bad' economic outlook\0"
+    "FCC authorizes SpaceX to use its Starlink satellite internet for vehicles\0"
+    "Spirit Airlines rejects JetBlue's $3.6 billion bid, sticks with Frontier deal\0"
+    "Disney+ ad-supported tier coming in late 2022 as streaming losses mount\0"
+    "Mark Zuckerberg's wealth reportedly took a $31 billion hit in 2022\0"
+    "Tesla's office employees ordered to work remotely over security concerns\0"
+    "Google agrees to $90 million settlement in ad-tracking privacy case\0"
+    "Amazon announces plan to overtake UPS and FedEx in package delivery race\0"
+    "Netflix admits it released an 'unprecedented level' of content in 2022\0"
+    "Toyota set to top General Motors as US sales crown goes up for grabs\0"
+    "\0"
+
+    // Jul 2022
+    "Elon Musk terminates $44 billion Twitter deal amid bot battle\0"
+    "Biden signs executive order aimed at limiting US investment in China AI, tech\0"
+    "UK imposes 25% windfall tax on oil and gas producers' profits\0"
+    "Twitter sues Elon Musk for terminating $44 billion acquisition deal\0"
+    "Apple employee fired after leading movement against return-to-office rules\0"
+    "Amazon announces plan to acquire primary healthcare provider One Medical for $3.9B\0"
+    "Microsoft reportedly laying off employees across multiple divisions\0"
+    "Elon Musk's SpaceX hit by cyber attack, $240,000 of liquid stolen\0"
+    "ESPN explores sports betting partnerships as industry matures\0"
+    "Netflix confirms it is bringing video games to its platform\0"
+    "\0"
+
+    // Aug 2022
+    "Elon Musk sells $6.9 billion of Tesla shares ahead of Twitter legal battle\0"
+    "Southwest Airlines kicks off massive hiring event for 8,000 workers\0"
+    "SoftBank reports $37 billion investment loss, Masayoshi Son remorseful\0"
+    "Bed Bath & Beyond's CFO Gustavo Arnal dies after falling from NYC skyscraper\0"
+    "Amazon expanding grocery footprint with $3.9 billion buyout of One Medical\0"
+    "Disney World got caught photoshopping maskless rider photo during pandemic\0"
+    "Ford hikes price of its electric F-150 Lightning by $8,500 due to supply costs\0"
+    "Zoom lays off 1,300 employees amid sagging demand for video software\0"
+    "Facebook settles lawsuit in revenge porn case, agreeing to bolster practices\0"
+    "Microsoft confirms plans to put Call of Duty games on Steam if Activision deal closes\0"
+    "\0"
+
+    // Sep 2022
+    "JPMorgan Chase begins prepping for 'potentially harsh recession' in 2023\0"
+    "Uber investigates 'cybersecurity incident' after breaching involving hacker\0"
+    "Disney CEO Bob Chapek ousted as Bob Iger makes shocking return as chief executive\0"
+    "FedEx warns of a looming global recession, shares plunge 21%\0"
+    "Meta shares tumble 9% as Zuckerberg doubles down on spending for metaverse\0"
+    "Elon Musk revives $44 billion Twitter deal after legal battle\0"
+    "Jeff Bezos donates $100 million to the Obama Foundation leadership program\0"
+    "Porsche takes off in one of the biggest debuts for a sports car brand\0"
+    "Dismal Amazon growth stokes recession fears and shaves $80 billion off value\0"
+    "Peloton slashing 500 more jobs as new CEO pursues restructuring\0"
+    "\0"
+
+    // Oct 2022
+    "Elon Musk takes over Twitter after $44 billion acquisition\0"
+    "US stocks tumble after latest Fed rate hike, Microsoft and Alphabet tank\0"
+    "Meta loses $700 billion in market value amid 'Metaverse' spending\0"
+    "Boeing on track to produce at least 31 Dreamliners monthly in 2024\0"
+    "Apple launches its most expensive iPhone lineup with iPhone 14 Pro Max\0"
+    "Jeff Bezos' rocket company Blue Origin suffers first big launch failure\0"
+    "Binance pitches crypto regulation to Biden administration amid industry turmoil\0"
+    "Elon Musk plans to eliminate half of Twitter's workforce after acquisition\0"
+    "Tesla misses Q3 expectations but offers bullish 2023 outlook\0"
+    "Google loses defamation case over 'criminal' search image\0"
+    "\0"
+
+    // Nov 2022
+    "Elon Musk cuts half of Twitter workforce amid effort to find profits\0"
+    "Jeff Bezos warns of impending 'economic hurricane,' Biden blames inflation on greed\0"
+    "Southwest Airlines cuts over 20,000 flights as meltdown enters fifth day\0"
+    "Apple threatened to kick Elon Musk's Twitter off App Store amid content turmoil\0"
+    "US senators call for a ban on Google's Ivy AI research amid sentience concerns\0"
+    "Tesla shares fall after Musk tells staff to not be 'bothered by stock market craziness'\0"
+    "Largest NFT mint in history aims to preserve Ukraine's cultural heritage\0"
+    "Elon Musk opens fire at Twitter's ex-employees who were critical of mass layoffs\0"
+    "TikTok accused of promoting pro-eating disorder content to vulnerable teens\0"
+    "Taylor Swift's 'Anti-Hero' smashes Spotify streaming records for viral hit song\0"
+    "\0"
+
+    // Dec 2022
+    "Elon Musk has Neuralink put brain chips in pigs and monkeys during company event\0"
+    "Apple faces full-blown Los Angeles labor dispute after workers walked off job\0"
+    "Amazon to spend $1 billion on warehouses in 2022 as it resets operations\0"
+    "Apple missing plan for hybrid work from home actually hurts diversity, say employees\0"
+    "Google settles Arizona legal case over tracking of Android users' locations\0"
+    "FCC bans imports and sales of Huawei and ZTE telecom equipment citing national security\0"
+    "Southwest meltdown leaves harried travelers to fend for themselves over busiest period\0"
+    "Elon Musk and Apple reach agreement amid battles over Twitter moderation\0"
+    "Tesla stock crashes nearly 65% in 2022, trapping option traders in brutal losing trades\0"
+    "Microsoft threatens to restrict data from rival AI search services\0"
+    "\0"
+
+    // Jan 2023
+    "Elon Musk faces deposition ahead of upcoming trial over 'funding secured' tweet\0"
+    "Microsoft unveils multibillion-dollar investment in AI computing power with OpenAI\0"
+    "Amazon begins latest round of job cuts affecting 18,000 employees\0"
+    "Google parent Alphabet to lay off 12,000 workers globally as AI race heats up\0"
+    "Foxconn apologizes for technical error that triggered a factory worker protest\0"
+    "Intel hit by shareholder lawsuit over alleged defective chip misinformation\0"
+    "Microsoft invests billions more in ChatGPT maker OpenAI amid AI frenzy\0"
+    "Uber restarts robotaxi service in Las Vegas after two-year pause amid pandemic\0"
+    "FTX founder Sam Bankman-Fried objects to tighter bail, says he's being mistreated\0"
+    "Fully autonomous trucking startup Gatik partners with Isuzu for new mass production deal\0"
+    "\0"
+
+    // Feb 2023
+    "Spotify cuts 6% of its workforce as tech layoffs intensify\0"
+    "Elon Musk defiantly defends himself in Tesla tweet trial testimony\0"
+    "Disney to cut 7,000 jobs as streaming losses mount and CEO prioritizes profits\0"
+    "SoFi to cut more than 7% of workforce amid mounting loan losses\0"
+    "Airbnb records over $1.9 billion in revenue, beating estimates in fourth quarter\0"
+    "Electric vehicles outsold gas-powered cars in Norway for the first time in 2022\0"
+    "TikTok CEO grilled by US lawmakers amid potential nationwide ban over security fears\0"
+    "Boeing defense arm to be arraigned in case over ill-fated Air Force One deal\0"
+    "Mercedes aims to capture 15% of upcoming electric truck market with new model\0"
+    "Mark Zuckerberg assures no plans to sell Instagram or WhatsApp after Meta layoffs\0"
+    "\0"
+
+    // Mar 2023
+    "Morgan Stanley kicks off Wall Street job cut of over 3,000 employees\0"
+    "Sam Altman's OpenAI launches paid version of ChatGPT with new capabilities\0"
+    "Musk scores minor win in 'funding secured' trial over 2018 Tesla tweets\0"
+    "Netflix launches new double thumbs up rating to improve recommendations\0"
+    "Coinbase to cut 20% of workforce in 'brutal' crypto winter\0"
+    "EU hits Microsoft with fresh antitrust charge amid Activision deal scrutiny\0"
+    "Starbucks enlists former Uber executive to lead company's AI efforts\0"
+    "Internet pioneer Michael Saylor steps down as MicroStrategy's executive chairman\0"
+    "Google cuts cloud computing area in latest round of staff layoffs\0"
+    "Biden, Republicans dig in over debt ceiling with no solution in sight\0"
+    "\0"
+
+    // Apr 2023
+    "US economic growth slows sharply to 0.6% as banking turmoil takes toll\0"
+    "YouTube to allow creators to sell ad space for its premium service\0"
+    "General Electric plans to shed health unit for $21 billion in spinoff deal\0"
+    "Emirates inks deal for 40 Boeing Dreamliner jets worth $16 billion\0"
+    "Disney undergoes another round of layoffs, impacting 4,000 employees\0"
+    "TikTok CEO grilled again by lawmakers amid looming nationwide ban over security\0"
+    "First Citizens Bank to acquire Silicon Valley Bank deposits and loans\0"
+    "Impossible Foods partners with McDonald's for test of new plant-based burger\0"
+    "VP Kamala Harris involved in Air Force Two airport incident and probe\0"
+    "Elon Musk celebrates court victory in battle over 2018 Tesla tweets\0"
+    "\0"
+
+    // May 2023
+    "Volkswagen to invest $193 billion to overtake Tesla in EV production\0"
+    "Apple suppliers reportedly seeking 25% increase for next iPhone\0"
+    "Adobe wins approval to buy Figma in $20 billion buyout after concessions\0"
+    "T-Mobile to buy Ryan Reynolds' Mint Mobile brand for $1.35 billion\0"
+    "Bankrupt crypto lender Celsius won't return customer crypto deposits\0"
+    "Disney delays several Marvel movies, adds new 'Avengers' and 'Fantastic Four' dates\0"
+    "Twitter board backs keeping Elon Musk's 2020 acquisition deal intact\0"
+    "Trump mugshot released after being booked at Fulton County jail in Georgia\0"
+    "SpaceX achieves key 'launch and catch' milestone for fully reusable rockets\0"
+    "Uber and Google's Waymo announce long-term self-driving partnership\0"
+    "\0"
+
+    // Jun 2023
+    "Nvidia stock notches huge rally on booming AI demand, $1 trillion market cap\0"
+    "Microsoft unveils premium version of Teams with AI enhancements from ChatGPT\0"
+    "NASA's Boeing Starliner capsule docks to ISS for first time after years of delays\0"
+    "Amazon to slash another 9,000 jobs across AWS, advertising and Twitch units\0"
+    "Airbnb announces new 'anti-party technology' to spot potential unruly bookings\0"
+    "HBO Max and Discovery+ merging to form new streaming service 'Max'\0"
+    "Nintendo Switch successor reportedly coming in 2024 with 8K support\0"
+    "Intel faces renewed pressure as rival AMD gains ground with new server chips\0"
+    "Elon Musk's SpaceX raising $1.7 billion to build out Starlink global internet\0"
+    "Ford, GM split on when to go all-electric in lineup amid legislative pushes\0"
+    "\0"
+
+    // Jul 2023
+    "Microsoft and Samsung join forces on AI and mobile gaming partnership\0"
+    "Twitter sues Elon Musk to enforce $44 billion buyout after he backs out\0"
+    "Tesla reports record revenue and profit but misses delivery expectations\0"
+    "FAA computer system failure grounds flights across US over safety concerns\0"
+    "Meta shares surge on signs metaverse investments may be paying off\0"
+    "Amazon to upend medical supply delivery with $3.9 billion acquisition of Intermountain\0"
+    "Bill Gates says AI like ChatGPT is as revolutionary as the internet\0"
+    "Netflix confirms plans to crackdown on password sharing for ad-supported tier\0"
+    "HBO hit series 'The Last of Us' greenlit for Season 2 after breakout success\0"
+    "Foxconn's India iPhone plant remains shuttered amid worker unrest\0"
+    "\0"
+
+    // Aug 2023
+    "US debt ceiling deal reached, averting catastrophic default\0"
+    "Virgin Orbit's final mission ends in failure, company reportedly winds down operations\0"
+    "TikTok could face $29 million fine from UK for failing to protect children's privacy\0"
+    "Intel wins first major cloud customer with historical Microsoft partnership\0"
+    "Tesla's robotaxi service to charge much less than Uber and Lyft\0"
+    "Netflix explores introduction of live streaming for reality shows and stand-up\0"
+    "Twitch CEO says company is 'evaluating' banning gambling streams amid backlash\0"
+    "Peloton shakes up leadership again with new CEO heading subscription push\0"
+    "Samsung teases new foldable phones as it seeks to cement market leadership\0"
+    "DOJ lawsuit aims to block $85 billion Microsoft-Activision Blizzard merger\0"
+    "\0"
+
+    // Sep 2023
+    "Federal Reserve hikes interest rates again to combat inflation\0"
+    "Tesla faces scrutiny over self-driving car accidents\0"
+    "Amazon announces major workforce cuts amid economic slowdown\0"
+    "Apple unveils new iPhone models with improved cameras and 5G\0"
+    "Elon Musk's Twitter deal faces regulatory hurdles\0"
+    "Global stock markets tumble on recession fears\0"
+    "Cryptocurrency market rebounds after months of turmoil\0"
+    "Oil prices surge as OPEC+ considers production cuts\0"
+    "Google faces antitrust lawsuits over alleged advertising monopoly\0"
+    "Meta (Facebook) lays off thousands as metaverse investments falter\0"
+    "\0"
+
+    // Oct 2023
+    "Inflation remains stubbornly high, raising recession fears\0"
+    "Major tech companies announce more layoffs amid economic downturn\0"
+    "United Auto Workers strike against Ford ends with new contract\0"
+    "Bitcoin nears record highs as institutional investors pile in\0"
+    "Saudi Aramco announces record profits on high oil prices\0"
+    "EU imposes new sanctions on Russia over Ukraine war escalation\0"
+    "US-China tensions rise over Taiwan and trade disputes\0"
+    "Disney's new streaming service faces stiff competition\0"
+    "Uber and Lyft face regulatory challenges over gig worker status\0"
+    "Boeing's troubled 737 MAX jet receives approval for key markets\0"
+    "\0"
+
+    // Nov 2023
+    "Black Friday sales surge as consumers hunt for bargains\0"
+    "Cryptocurrencies plummet as major exchange faces liquidity crisis\0"
+    "Retailers brace for supply chain disruptions during holidays\0"
+    "Disney's new Marvel film shatters box office records\0"
+    "Apple faces worker protests over strict COVID policies\0"
+    "Elon Musk's Twitter turmoil continues with advertiser exodus\0"
+    "Energy prices soar as OPEC considers deeper production cuts\0"
+    "US job growth slows amid rising interest rates\0"
+    "Major automakers announce ambitious electric vehicle plans\0"
+    "Amazon faces antitrust scrutiny over third-party seller policies\0"
+    "\0"
+
+    // Dec 2023
+    "Federal Reserve raises interest rates again to cool inflation\0"
+    "Tech giants announce more layoffs as recession fears mount\0"
+    "Holiday retail sales disappoint amid economic headwinds\0"
+    "Crypto market ends 2023 on a low note after FTX collapse\0"
+    "Elon Musk's Twitter deal faces renewed scrutiny from regulators\0"
+    "Boeing's 737 MAX troubles persist with new safety concerns\0"
+    "OPEC agrees to further oil production cuts, sending prices higher\0"
+    "China's economic growth slows amid zero-COVID policy challenges\0"
+    "Disney's Avatar sequel shatters box office records\0"
+    "Trade tensions rise as US targets Chinese semiconductor industry\0"
+    "\0"
+
+    // Jan 2024
+    "Global stock markets tumble on recession fears\0"
+    "Major tech layoffs continue as companies brace for downturn\0"
+    "Federal Reserve signals more interest rate hikes to come\0"
+    "Tesla misses delivery targets, stoking demand concerns\0"
+    "Boeing halts 737 MAX deliveries over new electrical issue\0"
+    "Crypto market volatility persists after FTX collapse\0"
+    "Disney's streaming subscriber growth slows amid competition\0"
+    "US unemployment rate ticks up as job market cools\0"
+    "Saudi Aramco announces record annual profits on high oil prices\0"
+    "China's reopening boosts economic outlook but risks remain\0"
+    "\0"
+
+    // Feb 2024
+    "Inflation remains stubbornly high despite Fed rate hikes\0"
+    "Major banks announce massive job cuts as recession looms\0"
+    "Tesla faces intensifying competition in electric vehicle market\0"
+    "Amazon's holiday quarter disappoints as consumer spending slows\0"
+    "Google hit with billions in fines over antitrust violations in Europe\0"
+    "Oil prices surge as Russia-Ukraine conflict escalates\0"
+    "GameStop stock soars as meme frenzy reignites\0"
+    "Disney's new Star Wars series faces mixed reviews\0"
+    "Boeing's 737 MAX faces renewed grounding threat over wing issue\0"
+    "US-China trade tensions flare up over Taiwan and chip restrictions\0"
+    "\0"
+
+    // Mar 2024
+    "Federal Reserve pauses interest rate hikes amid banking turmoil\0"
+    "Silicon Valley Bank collapse sparks fears of broader crisis\0"
+    "Major tech firms announce further layoffs to cut costs\0"
+    "Oil prices whipsaw as OPEC debates supply cuts\0"
+    "Disney's new Marvel film breaks box office records\0"
+    "US imposes new sanctions on Russia over continued Ukraine aggression\0"
+    "Tesla faces growing competition in electric vehicle market\0"
+    "Amazon's labor union battles intensify across warehouses\0"
+    "Cryptocurrency market shows signs of recovery after turbulent year\0"
+    "US-China tensions rise over Taiwan, technology restrictions\0"
+    "\0";
+
+static struct {
+    int nbars, nheadlines;
+    uint32_t *start;      // start[id] = offset of headline `id` in `pool`
+    uint32_t *bar_offset; // headlines of bar b are ids bar_offset[b] .. bar_offset[b + 1] - 1
+    int nsymbols;
+    uint32_t *tag_offset; // headlines tagged with symbol s are tag_ids[tag_offset[s] .. tag_offset[s + 1] - 1]
+    uint32_t *tag_ids;
+    int nterms;
+    struct term {
+        uint32_t start;    // offset in `pool` of the first occurrence of the term
+        uint32_t len;
+    } *terms;
+    uint32_t *slots;       // hash table of term index + 1 (0 = empty); size `nslots`, a power of two
+    uint32_t nslots;
+    uint32_t *post_offset; // headlines containing term t are postings[post_offset[t] .. post_offset[t + 1] - 1]
+    uint32_t *postings;
+} news;
+
+void news_init(void) {
+    // First pass counts bars and headlines so the offsets are sized exactly
+    const size_t size = sizeof(pool) - 1; // ignore the literal's own terminator
+    news.nbars = news.nheadlines = 0;
+    for (size_t p = 0; p < size; p += strlen(pool + p) + 1) {
+        if (pool[p] == '\0') news.nbars++;
+        else news.nheadlines++;
+    }
+    news.start = malloc(sizeof(uint32_t) * news.nheadlines);
+    news.bar_offset = malloc(sizeof(uint32_t) * (news.nbars + 1));
+
+    int id = 0, bar = 0;
+    news.bar_offset[0] = 0;
+    for (size_t p = 0; p < size; p += strlen(pool + p) + 1) {
+        if (pool[p] == '\0') news.bar_offset[++bar] = id;
+        else news.start[id++] = p;
+    }
+}
+
+int news_count(int bar) {
+    return news.bar_offset[bar + 1] - news.bar_offset[bar];
+}
+
+int news_first(int bar) {
+    return news.bar_offset[bar];
+}
+
+const char *news_text(int id) {
+    return pool + news.start[id];
+}
+
+int news_bar(int id) {
+    // binary search for the last bar starting at or before `id`
+    int lo = 0, hi = news.nbars - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (news.bar_offset[mid] <= id) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo;
+}
+
+static bool is_word_char(char ch) {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9');
+}
+
+static bool starts_with(const char *text, const char *word, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (text[i] != word[i]) return false; // also stops at the end of `text`
+    }
+    return true;
+}
+
+static bool mentions(const char *text, const char *word, size_t len) {
+    // true if `text` contains `word[0..len-1]` as a whole word
+    for (const char *p = text; *p; p++) {
+        if ((p == text || !is_word_char(p[-1])) && starts_with(p, word, len) && !is_word_char(p[len])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool tagged(const char *text, const char *keywords) {
+    while (*keywords) {
+        size_t len = 0;
+        while (keywords[len] && keywords[len] != ',') len++;
+        if (len > 0 && mentions(text, keywords, len)) return true;
+        keywords += len + (keywords[len] == ',');
+    }
+    return false;
+}
+
+bool news_tag_init(int nsymbols, const char *const keywords[]) {
+    // Two passes again: count matches per symbol, then fill the rows
+    news.nsymbols = nsymbols;
+    news.tag_offset = malloc(sizeof(uint32_t) * (nsymbols + 1));
+    if (news.tag_offset == NULL) return false;
+    news.tag_offset[0] = 0;
+    for (int s = 0; s < nsymbols; s++) {
+        int n = 0;
+        for (int id = 0; id < news.nheadlines; id++) {
+            n += tagged(news_text(id), keywords[s]);
+        }
+        news.tag_offset[s + 1] = news.tag_offset[s] + n;
+    }
+
+    news.tag_ids = malloc(sizeof(uint32_t) * (news.tag_offset[nsymbols] + 1));
+    if (news.tag_ids == NULL) return false;
+    for (int s = 0; s < nsymbols; s++) {
+        uint32_t *row = news.tag_ids + news.tag_offset[s];
+        for (int id = 0; id < news.nheadlines; id++) {
+            if (tagged(news_text(id), keywords[s])) *row++ = id;
+        }
+    }
+    return true;
+}
+
+int news_tagged(int symbol, const uint32_t **ids) {
+    *ids = news.tag_ids + news.tag_offset[symbol];
+    return news.tag_offset[symbol + 1] - news.tag_offset[symbol];
+}
+
+// Keyword search
+
+static const char *stop_words[] = {
+    "a", "an", "and", "as", "at", "by", "for", "from", "in", "into", "is", "it", "its",
+    "of", "on", "or", "over", "the", "to", "with",
+};
+
+static char lower(char ch) {
+    return (ch >= 'A' && ch <= 'Z') ? ch - 'A' + 'a' : ch;
+}
+
+static bool same_word(const char *a, const char *b, size_t len) {
+    // case-insensitive comparison of a[0..len-1] and b[0..len-1]
+    for (size_t i = 0; i < len; i++) {
+        if (lower(a[i]) != lower(b[i])) return false;
+    }
+    return true;
+}
+
+static bool is_stop_word(const char *word, size_t len) {
+    for (int i = 0; i < sizeof(stop_words) / sizeof(stop_words[0]); i++) {
+        if (strlen(stop_words[i]) == len && same_word(word, stop_words[i], len)) return true;
+    }
+    return false;
+}
+
+static uint32_t hash_word(const char *word, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (unsigned char)lower(word[i])) * 16777619u;
+    }
+    return h;
+}
+
+static uint32_t *find_slot(const char *word, size_t len) {
+    // Returns the slot holding `word`, or the empty slot where it belongs
+    uint32_t mask = news.nslots - 1;
+    for (uint32_t i = hash_word(word, len) & mask; ; i = (i + 1) & mask) {
+        uint32_t t = news.slots[i];
+        if (t == 0) return &news.slots[i];
+        const struct term *term = &news.terms[t - 1];
+        if (term->len == len && same_word(pool + term->start, word, len)) return &news.slots[i];
+    }
+}
+
+static const char *next_word(const char *p, size_t *len) {
+    // Returns the next indexable word at or after `p` (NULL at the end) and sets its length
+    while (*p) {
+        while (*p && !is_word_char(*p)) p++;
+        const char *start = p;
+        while (is_word_char(*p)) p++;
+        *len = p - start;
+        if (*len > 0 && !is_stop_word(start, *len)) return start;
+    }
+    return NULL;
+}
+
+bool news_search_init(void) {
+    // Size the tables from the total word count, then index in two passes:
+    // count each term's document frequency, then fill the posting lists
+    size_t len, nwords = 0;
+    for (int id = 0; id < news.nheadlines; id++) {
+        for (const char *w = next_word(news_text(id), &len); w; w = next_word(w + len, &len)) nwords++;
+    }
+    news.nslots = 1;
+    while (news.nslots < 2 * nwords) news.nslots <<= 1;
+    news.slots = malloc(sizeof(uint32_t) * news.nslots);
+    news.terms = malloc(sizeof(struct term) * nwords);
+    uint32_t *last = malloc(sizeof(uint32_t) * nwords); // last headline counted per term, to count each once
+    news.post_offset = malloc(sizeof(uint32_t) * (nwords + 1));
+    if (!news.slots || !news.terms || !last || !news.post_offset) return false;
+    memset(news.slots, 0, sizeof(uint32_t) * news.nslots);
+    memset(news.post_offset, 0, sizeof(uint32_t) * (nwords + 1));
+
+    news.nterms = 0;
+    for (int id = 0; id < news.nheadlines; id++) {
+        for (const char *w = next_word(news_text(id), &len); w; w = next_word(w + len, &len)) {
+            uint32_t *slot = find_slot(w, len);
+            if (*slot == 0) {
+                news.terms[news.nterms] = (struct term){ .start = w - pool, .len = len };
+                last[news.nterms] = id;
+                news.post_offset[news.nterms + 1] = 1;
+                *slot = ++news.nterms;
+            } else if (last[*slot - 1] != id) {
+                last[*slot - 1] = id;
+                news.post_offset[*slot]++;
+            }
+        }
+    }
+    for (int t = 0; t < news.nterms; t++) {
+        news.post_offset[t + 1] += news.post_offset[t];
+    }
+
+    news.postings = malloc(sizeof(uint32_t) * (news.post_offset[news.nterms] + 1));
+    if (news.postings == NULL) return false;
+    uint32_t *fill = last; // reuse: next free position in each posting list
+    for (int t = 0; t < news.nterms; t++) fill[t] = news.post_offset[t];
+    for (int id = 0; id < news.nheadlines; id++) {
+        for (const char *w = next_word(news_text(id), &len); w; w = next_word(w + len, &len)) {
+            uint32_t t = *find_slot(w, len) - 1;
+            if (fill[t] == news.post_offset[t] || news.postings[fill[t] - 1] != id) {
+                news.postings[fill[t]++] = id;
+            }
+        }
+    }
+    free(last);
+    return true;
+}
+
+int news_search(const char *const words[], int nwords, int limit, uint32_t hits[], int scores[], int max_hits) {
+    // Walk the query's posting lists newest-first in lockstep (a k-way merge
+    // on descending ids); a headline's score is the number of lists it is on.
+    // Hits are bucketed by score so the best `max_hits` come out without sorting.
+    const uint32_t *list[NEWS_MAX_TERMS];
+    int pos[NEWS_MAX_TERMS], k = 0;
+    for (int i = 0; i < nwords && i < NEWS_MAX_TERMS; i++) {
+        uint32_t t = *find_slot(words[i], strlen(words[i]));
+        if (t == 0) continue; // word never appears
+        list[k] = news.postings + news.post_offset[t - 1];
+        // binary search: start at the newest posting below `limit`
+        int lo = 0, hi = news.post_offset[t] - news.post_offset[t - 1];
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (list[k][mid] < limit) lo = mid + 1;
+            else hi = mid;
+        }
+        pos[k++] = lo - 1;
+    }
+
+    uint32_t bucket[NEWS_MAX_TERMS + 1][max_hits];
+    int nbucket[NEWS_MAX_TERMS + 1];
+    memset(nbucket, 0, sizeof(nbucket));
+    while (nbucket[k] < max_hits) {
+        int id = -1;
+        for (int i = 0; i < k; i++) {
+            if (pos[i] >= 0 && (int)list[i][pos[i]] > id) id = list[i][pos[i]];
+        }
+        if (id < 0) break;
+        int score = 0;
+        for (int i = 0; i < k; i++) {
+            if (pos[i] >= 0 && list[i][pos[i]] == id) {
+                score++;
+                pos[i]--;
+            }
+        }
+        if (nbucket[score] < max_hits) bucket[score][nbucket[score]++] = id;
+    }
+
+    int n = 0;
+    for (int score = k; score > 0 && n < max_hits; score--) {
+        for (int i = 0; i < nbucket[score] && n < max_hits; i++, n++) {
+            hits[n] = bucket[score][i];
+            scores[n] = score;
+        }
+    }
+    return n;
+}
@@ -0,0 +1,108 @@
+#ifndef NEWS_H
+#define NEWS_H
+
+/*
+ * News store.
+ *
+ * Headlines are kept in compressed sparse row form: a single string pool
+ * holds every headline back to back, `news_first(bar)` gives the id of the
+ * first headline of each bar, and headline ids are assigned in time
+ * order. Memory is proportional to the number of headlines actually
+ * present rather than to bars times a fixed maximum per bar.
+ *
+ * A tag index maps each symbol to the (chronological) ids of the
+ * headlines that mention it, so "news for NVDA" costs O(matches).
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * `news_init`: Required initialization for module
+ *
+ * Builds the row offsets over the headline pool.
+ */
+void news_init(void);
+
+/*
+ * `news_count`
+ *
+ * @return   the number of headlines published in bar `bar`
+ */
+int news_count(int bar);
+
+/*
+ * `news_first`
+ *
+ * @return   the id of the first headline of bar `bar`; headlines of bars
+ *           before `bar` have smaller ids. `news_first(nbars)` is the
+ *           total number of headlines.
+ */
+int news_first(int bar);
+
+/*
+ * `news_text`
+ *
+ * @return   the text of headline `id`
+ */
+const char *news_text(int id);
+
+/*
+ * `news_bar`
+ *
+ * @return   the bar in which headline `id` was published
+ */
+int news_bar(int id);
+
+/*
+ * `news_tag_init`
+ *
+ * Builds the tag index. `keywords[s]` is a comma-separated list of words
+ * or phrases identifying symbol `s` (e.g. "Meta,Facebook"); a headline is
+ * tagged with `s` if it contains one of them as a whole word
+ * (case-sensitive).
+ *
+ * @return   false if out of memory
+ */
+bool news_tag_init(int nsymbols, const char *const keywords[]);
+
+/*
+ * `news_tagged`
+ *
+ * Sets `*ids` to the ids of headlines mentioning symbol `symbol`, in
+ * chronological order.
+ *
+ * @return   the number of such headlines
+ */
+int news_tagged(int symbol, const uint32_t **ids);
+
+/*
+ * `news_search_init`
+ *
+ * Builds the keyword index: every word of every headline (lowercased,
+ * ignoring very common words) maps to the chronological list of ids of
+ * the headlines containing it.
+ *
+ * @return   false if out of memory
+ */
+bool news_search_init(void);
+
+/*
+ * `news_search`
+ *
+ * Finds headlines with ids below `limit` containing the given words.
+ * Hits are ranked by how many of the words they contain (so headlines in
+ * the intersection of all the posting lists come first), then newest
+ * first.
+ *
+ * @param words     the query words (any case)
+ * @param nwords    number of query words, at most NEWS_MAX_TERMS
+ * @param limit     only headlines with id < limit are considered
+ * @param hits      filled with up to `max_hits` headline ids, best first
+ * @param scores    filled with the number of query words each hit contains
+ * @return          the number of hits written
+ */
+#define NEWS_MAX_TERMS 8
+int news_search(const char *const words[], int nwords, int limit, uint32_t hits[], int scores[], int max_hits);
+
+#endif
@@ -0,0 +1,43 @@
+/* File: prng.c
+ * ------------
+ * This file implements the generator outlined in `prng.h`
+ * Reference: Vigna, "An experimental exploration of Marsaglia's xorshift generators"
+ */
+#include "prng.h"
+
+static uint64_t splitmix64(uint64_t x) {
+    // scrambles the seed so that seeds 1, 2, 3... give unrelated states
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+void prng_seed(prng_t *rng, uint64_t seed) {
+    rng->state = splitmix64(seed);
+    if (rng->state == 0) rng->state = 1; // xorshift never leaves the all-zero state
+}
+
+uint64_t prng_next(prng_t *rng) {
+    uint64_t x = rng->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    rng->state = x;
+    return x * 0x2545f4914f6cdd1dULL;
+}
+
+float prng_uniform(prng_t *rng) {
+    // top 24 bits fill a float mantissa exactly
+    return (prng_next(rng) >> 40) * (1.0f / 16777216.0f);
+}
+
+uint32_t prng_range(prng_t *rng, uint32_t n) {
+    return (uint32_t)(((prng_next(rng) >> 32) * n) >> 32);
+}
+
+float prng_normal(prng_t *rng) {
+    // Irwin-Hall: the sum of 4 uniforms has mean 2 and variance 1/3
+    float s = prng_uniform(rng) + prng_uniform(rng) + prng_uniform(rng) + prng_uniform(rng);
+    return (s - 2) * 1.7320508f;
+}
@@ -0,0 +1,55 @@
+#ifndef PRNG_H
+#define PRNG_H
+
+/*
+ * Small, fast, seedable pseudo-random number generator (xorshift64*).
+ *
+ * Every stream is fully determined by its seed, so anything driven by it
+ * (synthetic ticks, simulated traders) replays identically from the same
+ * seed. Not suitable for cryptography.
+ */
+
+#include <stdint.h>
+
+typedef struct {
+    uint64_t state;
+} prng_t;
+
+/*
+ * `prng_seed`
+ *
+ * Initializes `rng` from `seed`. Any seed is fine (including 0); nearby
+ * seeds produce unrelated streams.
+ */
+void prng_seed(prng_t *rng, uint64_t seed);
+
+/*
+ * `prng_next`
+ *
+ * Returns the next 64 pseudo-random bits of the stream.
+ */
+uint64_t prng_next(prng_t *rng);
+
+/*
+ * `prng_uniform`
+ *
+ * Returns a pseudo-random float uniformly distributed in [0, 1).
+ */
+float prng_uniform(prng_t *rng);
+
+/*
+ * `prng_range`
+ *
+ * Returns a pseudo-random integer uniformly distributed in [0, n). n > 0.
+ */
+uint32_t prng_range(prng_t *rng, uint32_t n);
+
+/*
+ * `prng_normal`
+ *
+ * Returns an approximately standard normal float (mean 0, variance 1),
+ * computed from a sum of uniforms so no transcendental math is needed.
+ */
+float prng_normal(prng_t *rng);
+
+#endif
@@ -0,0 +1,66 @@
+/* File: ring.c
+ * ------------
+ * This file implements the lock-free ring buffer outlined in `ring.h`
+ */
+#include "ring.h"
+#ifdef HOSTED
+#include <string.h>
+#else
+#include "strings.h"
+#endif
+
+// Acquire: later loads and stores stay after the loads before the fence.
+// Release: earlier loads and stores complete before the stores after it.
+#if defined(__riscv)
+#define FENCE_ACQUIRE() __asm__ volatile ("fence r, rw" ::: "memory")
+#define FENCE_RELEASE() __asm__ volatile ("fence rw, w" ::: "memory")
+#else
+#define FENCE_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif
+
+static uint8_t *slot(const ring_t *ring, uint32_t pos) {
+    return ring->slots + (pos & ring->mask) * ring->elem_size;
+}
+
+bool ring_init(ring_t *ring, void *storage, uint32_t capacity, uint32_t elem_size) {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) return false;
+    ring->head = ring->tail = 0;
+    ring->slots = storage;
+    ring->mask = capacity - 1;
+    ring->elem_size = elem_size;
+    return true;
+}
+
+bool ring_push(ring_t *ring, const void *elems, uint32_t n) {
+    uint32_t head = ring->head; // our own counter
+    uint32_t tail = ring->tail;
+    FENCE_ACQUIRE(); // the consumer is done with slots before `tail` before we overwrite them
+    if (ring->mask + 1 - (head - tail) < n) return false;
+    const uint8_t *src = elems;
+    for (uint32_t k = 0; k < n; k++) {
+        memcpy(slot(ring, head + k), src + k * ring->elem_size, ring->elem_size);
+    }
+    FENCE_RELEASE(); // the elements are in place before `head` publishes them
+    ring->head = head + n;
+    return true;
+}
+
+bool ring_pop(ring_t *ring, void *elem) {
+    uint32_t tail = ring->tail; // our own counter
+    uint32_t head = ring->head;
+    FENCE_ACQUIRE(); // the slots before `head` are read only after `head` is
+    if (head == tail) return false;
+    memcpy(elem, slot(ring, tail), ring->elem_size);
+    FENCE_RELEASE(); // the element is copied out before `tail` frees its slot
+    ring->tail = tail + 1;
+    return true;
+}
+
+uint32_t ring_count(const ring_t *ring) {
+    return ring->head - ring->tail;
+}
+
+uint32_t ring_space(const ring_t *ring) {
+    return ring->mask + 1 - (ring->head - ring->tail);
+}
@@ -0,0 +1,80 @@
+#ifndef RING_H
+#define RING_H
+
+/*
+ * Lock-free single-producer/single-consumer ring buffer.
+ *
+ * A ring holds up to `capacity` fixed-size elements, where `capacity` is a
+ * power of two so a position maps to its slot with a mask. `head` counts
+ * the elements ever pushed and only the producer writes it; `tail` counts
+ * the elements ever popped and only the consumer writes it. Each side
+ * reads the other's counter, copies the elements, and then publishes its
+ * own counter behind a fence. The consumer therefore never sees a slot
+ * before its contents, and the producer never reuses a slot before its
+ * contents have been read. No locks or read-modify-write atomics are
+ * needed, so the same code works between an interrupt handler and the
+ * main loop, or between two threads on a hosted build (-DHOSTED).
+ *
+ * The counters sit on separate cache lines, so the two sides do not
+ * false-share them. Exactly one producer and one consumer may use a ring
+ * at a time; anything else must be serialized by the caller.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define RING_CACHE_LINE 64
+
+typedef struct {
+    volatile uint32_t head __attribute__((aligned(RING_CACHE_LINE))); // written by the producer only
+    volatile uint32_t tail __attribute__((aligned(RING_CACHE_LINE))); // written by the consumer only
+    uint8_t *slots __attribute__((aligned(RING_CACHE_LINE)));         // read-only after `ring_init`
+    uint32_t mask;          // capacity - 1
+    uint32_t elem_size;     // bytes per element
+} ring_t;
+
+/*
+ * `ring_init`
+ *
+ * Makes `ring` an empty ring of `capacity` elements of `elem_size` bytes
+ * each, kept in `storage`, which must hold `capacity * elem_size` bytes.
+ *
+ * @return   false if `capacity` is not a power of two
+ */
+bool ring_init(ring_t *ring, void *storage, uint32_t capacity, uint32_t elem_size);
+
+/*
+ * `ring_push`
+ *
+ * Producer: appends the `n` elements at `elems`, all or none.
+ *
+ * @return   false (and pushes nothing) if there is no room for all of them
+ */
+bool ring_push(ring_t *ring, const void *elems, uint32_t n);
+
+/*
+ * `ring_pop`
+ *
+ * Consumer: removes the oldest element into `elem`.
+ *
+ * @return   false if the ring is empty
+ */
+bool ring_pop(ring_t *ring, void *elem);
+
+/*
+ * `ring_count`
+ *
+ * @return   the number of elements in the ring; exact for the consumer,
+ *           a lower bound for the producer
+ */
+uint32_t ring_count(const ring_t *ring);
+
+/*
+ * `ring_space`
+ *
+ * @return   the number of elements that fit; exact for the producer, a
+ *           lower bound for the consumer
+ */
+uint32_t ring_space(const ring_t *ring);
+
+#endif
@@ -0,0 +1,101 @@
+/* File: risk.c
+ * ------------
+ * This file implements the pre-trade risk checks outlined in `risk.h`
+ */
+#include "risk.h"
+#include <stdint.h>
+
+long risk_buying_power(const risk_limits_t *limits, const risk_exposure_t *exposure) {
+    if (limits->initial_margin_pct <= 0) return INT64_MAX;
+    long excess = exposure->equity - exposure->gross * limits->initial_margin_pct / 100;
+    return excess * 100 / limits->initial_margin_pct;
+}
+
+long risk_margin_deficit(const risk_limits_t *limits, long equity, long gross) {
+    return gross * limits->maint_margin_pct / 100 - equity;
+}
+
+static int closing(int position, int open_buys, int open_sells, side_t side, int qty, int *after) {
+    // Returns how much of the order closes a position, and sets `after` to the
+    // position on its side (shares long for buys, short for sells) once every
+    // resting order on that side fills too
+    int left;
+    if (side == SIDE_BUY) {
+        left = -(position + open_buys);
+        *after = position + open_buys + qty;
+    } else {
+        left = position - open_sells;
+        *after = -(position - open_sells - qty);
+    }
+    return (left <= 0 ? 0 : left < qty ? left : qty);
+}
+
+static risk_result_t check_symbol(const risk_limits_t *limits, side_t side, int after) {
+    if (after > limits->max_position) return RISK_POSITION;
+    if (side == SIDE_SELL && after > limits->max_short) return RISK_BORROW;
+    return RISK_OK;
+}
+
+risk_result_t risk_check(const risk_limits_t *limits, const risk_exposure_t *exposure, side_t side, int qty, price_t price) {
+    if (qty > limits->max_order_qty) return RISK_ORDER_SIZE;
+    int after;
+    int closed = closing(exposure->position, exposure->open_buys, exposure->open_sells, side, qty, &after);
+    if (closed == qty) return RISK_OK;
+    risk_result_t result = check_symbol(limits, side, after);
+    if (result != RISK_OK) return result;
+    long opening = (long)(qty - closed) * price;
+    if (exposure->gross + opening > limits->max_gross) return RISK_GROSS;
+    if (opening > risk_buying_power(limits, exposure)) return RISK_BUYING_POWER;
+    return RISK_OK;
+}
+
+risk_result_t risk_check_basket(const risk_limits_t *limits, const risk_exposure_t *account, const risk_leg_t legs[], int n, int *failed) {
+    risk_exposure_t portfolio = *account;
+    bool opens = false;
+    for (int k = 0; k < n; k++) {
+        const risk_leg_t *leg = &legs[k];
+        *failed = k;
+        if (leg->qty > limits->max_order_qty) return RISK_ORDER_SIZE;
+        int after;
+        int closed = closing(leg->position, leg->open_buys, leg->open_sells, leg->side, leg->qty, &after);
+        if (closed < leg->qty) {
+            risk_result_t result = check_symbol(limits, leg->side, after);
+            if (result != RISK_OK) return result;
+            opens = true;
+        }
+        portfolio.gross += (long)(leg->qty - 2 * closed) * leg->price; // opened less closed
+    }
+    *failed = -1;
+    if (!opens) return RISK_OK;
+    if (portfolio.gross > limits->max_gross) return RISK_GROSS;
+    if (risk_buying_power(limits, &portfolio) < 0) return RISK_BUYING_POWER;
+    return RISK_OK;
+}
+
+bool risk_throttle(risk_throttle_t *throttle, const risk_limits_t *limits, unsigned long now_usecs) {
+    long cap = (long)limits->burst * RISK_TOKEN;
+    unsigned long elapsed = now_usecs - throttle->last_usecs;
+    throttle->last_usecs = now_usecs;
+    // refill; the cap check first keeps a long idle stretch from overflowing
+    if (elapsed >= (unsigned long)cap || throttle->tokens + (long)elapsed * limits->orders_per_sec >= cap) {
+        throttle->tokens = cap;
+    } else {
+        throttle->tokens += (long)elapsed * limits->orders_per_sec;
+    }
+    if (throttle->tokens < RISK_TOKEN) return false;
+    throttle->tokens -= RISK_TOKEN;
+    return true;
+}
+
+const char *risk_reason(risk_result_t result) {
+    switch (result) {
+        case RISK_OK: return "ok";
+        case RISK_ORDER_SIZE: return "order larger than the maximum order size";
+        case RISK_POSITION: return "position would exceed the maximum position";
+        case RISK_BORROW: return "short sale would exceed the borrow limit";
+        case RISK_GROSS: return "gross exposure would exceed its limit";
+        case RISK_BUYING_POWER: return "not enough buying power";
+        case RISK_THROTTLE: return "too many orders; slow down";
+    }
+    return "unknown";
+}
@@ -0,0 +1,130 @@
+#ifndef RISK_H
+#define RISK_H
+
+/*
+ * Pre-trade risk checks.
+ *
+ * Every limit is checked against running aggregates the exchange
+ * already keeps up to date for each account (position, open orders,
+ * gross exposure, equity), so checking an order is a handful of integer
+ * comparisons no matter how large the portfolio is. The module only
+ * decides; it never changes an account.
+ *
+ * Positions may be short. Only the part of an order that opens or adds to
+ * a position is checked against the position, borrow, gross and margin
+ * limits; the part that closes one only ever lowers risk. Margin works
+ * on gross exposure, the sum of |position| times mark: a new position
+ * needs `initial_margin_pct` of its value in excess equity, and an
+ * account whose equity falls below `maint_margin_pct` of its gross
+ * exposure is due a margin call.
+ */
+
+#include <stdbool.h>
+#include "book.h"
+
+#define RISK_TOKEN 1000000L // throttle credit for one order
+
+typedef struct {
+    int max_order_qty;          // shares in a single order
+    int max_position;           // shares of one symbol, long or short, counting open orders
+    int max_short;              // shares of one symbol that may be borrowed to sell short
+    long max_gross;             // cents of |positions| at their marks plus open buy orders
+    int initial_margin_pct;     // share of a new position paid from equity: 100 = cash only, 50 = 2:1
+    int maint_margin_pct;       // equity below this share of gross exposure is a margin call
+    int orders_per_sec, burst;  // throttle: sustained order rate and how many may come at once
+} risk_limits_t;
+
+typedef struct {
+    long tokens;                // order credits, in units of 1 / RISK_TOKEN orders
+    unsigned long last_usecs;   // time of the last refill
+} risk_throttle_t;
+
+// An account's running aggregates as seen by one order on one symbol
+typedef struct {
+    int position;               // shares held (negative if short), including shares held for resting sells
+    int open_buys, open_sells;  // shares in resting orders
+    long gross;                 // cents: |positions| at their marks plus open buy orders
+    long equity;                // cents: cash, holds and market value
+} risk_exposure_t;
+
+// One order of a basket: the account's aggregates for its symbol, and the order
+typedef struct {
+    int position;               // as in risk_exposure_t
+    int open_buys, open_sells;
+    side_t side;
+    int qty;
+    price_t price;
+} risk_leg_t;
+
+typedef enum {
+    RISK_OK = 0,
+    RISK_ORDER_SIZE,
+    RISK_POSITION,
+    RISK_BORROW,
+    RISK_GROSS,
+    RISK_BUYING_POWER,
+    RISK_THROTTLE,
+} risk_result_t;
+
+/*
+ * `risk_check`
+ *
+ * Checks an order for `qty` shares at `price` cents against `limits`.
+ *
+ * @return   RISK_OK, or the first limit the order would break
+ */
+risk_result_t risk_check(const risk_limits_t *limits, const risk_exposure_t *exposure, side_t side, int qty, price_t price);
+
+/*
+ * `risk_check_basket`
+ *
+ * Checks `legs[0..n-1]`, orders on distinct symbols for the account
+ * whose totals are `account`, as one change to the portfolio: each leg
+ * against the per-symbol limits, then the portfolio after every leg
+ * against the gross and initial margin limits, so a leg that frees
+ * margin pays for another that takes it. Fills at `price` are assumed to
+ * leave equity unchanged, as they do at the mark.
+ *
+ * @param failed   receives the index of the leg that broke a limit, or -1
+ *                 if the basket as a whole did
+ * @return         RISK_OK, or the first limit the basket would break
+ */
+risk_result_t risk_check_basket(const risk_limits_t *limits, const risk_exposure_t *account, const risk_leg_t legs[], int n, int *failed);
+
+/*
+ * `risk_buying_power`
+ *
+ * @return   cents of new positions the account may open at the initial
+ *           margin: its excess equity over the margin its gross exposure
+ *           already takes, scaled up by the leverage the margin allows
+ */
+long risk_buying_power(const risk_limits_t *limits, const risk_exposure_t *exposure);
+
+/*
+ * `risk_margin_deficit`
+ *
+ * @return   cents of equity an account with `equity` and `gross` exposure
+ *           lacks to meet the maintenance margin; zero or negative if it
+ *           meets it
+ */
+long risk_margin_deficit(const risk_limits_t *limits, long equity, long gross);
+
+/*
+ * `risk_throttle`
+ *
+ * Token bucket: refills at `orders_per_sec` up to `burst` orders and
+ * takes one order's credit if there is one.
+ *
+ * @param now_usecs   current time in microseconds
+ * @return            true if the order may proceed
+ */
+bool risk_throttle(risk_throttle_t *throttle, const risk_limits_t *limits, unsigned long now_usecs);
+
+/*
+ * `risk_reason`
+ *
+ * @return   a short description of `result`
+ */
+const char *risk_reason(risk_result_t result);
+
+#endif
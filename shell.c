@@ -209,13 +209,31 @@ typedef struct {
 } option_t;
 
 static const option_t options[] = {
-    {"buy",  "buy <symbol> <shares>",  "buys shares of a stock with a given ticker symbol"},
-    {"sell",  "sell <symbol> <shares>",  "sells a stock with a given ticker symbol"},
+    {"buy",  "buy <symbol> <shares> [limit] [ioc|fok|gtt <bars>|stop <price>]",  "buys shares of a stock with a given ticker symbol; a limit below the price rests on the book"},
+    {"sell",  "sell <symbol> <shares> [limit] [ioc|fok|gtt <bars>|stop <price>]",  "sells (or sells short) a stock with a given ticker symbol; a limit above the price rests on the book"},
+    {"cancel",  "cancel <id> | cancel stop <id>",  "cancels one of your resting orders or stops"},
+    {"replace",  "replace <id> <shares> <limit>",  "changes a resting order; lowering only the shares keeps its place in line"},
+    {"basket",  "basket <symbol> <shares> ...",  "trades several stocks at once, risk-checked as a whole; negative shares sell"},
+    {"rebalance",  "rebalance <symbol> <percent> ...",  "trades to a target allocation of your equity in one basket; unnamed stocks are closed out"},
     {"price",  "price <symbol>",  "return price a stock with a given ticker symbol"},
+    {"news",  "news <symbol> | news search <words...>",  "returns the latest headlines mentioning a stock, or best matches for the words"},
     {"graph",  "graph <symbol>",  "graphs a price a stock with a given ticker symbol"},
-    {"info",  "info",  "returns a table of owned stocks and their information", cmd_info},
+    {"info",  "info",  "returns a table of owned stocks with their cost basis and profit or loss", cmd_info},
+    {"basis",  "basis <fifo|avg>",  "sets how your cost basis is kept: FIFO lots or average cost"},
+    {"indicator",  "indicator <symbol> <name>",  "returns an indicator (sma, ema, std, upper, lower, rsi, vwap) of a stock"},
+    {"orders",  "orders",  "lists your resting orders, newest first"},
+    {"book",  "book <symbol>",  "shows the best bids and asks resting on a stock's order book"},
     {"pnl",  "pnl",  "returns how much money you have (stonks!)"},
     {"bankruptcy",  "bankruptcy [please]", "declares bankruptcy! we just print more money and get rid of your debt"},
+    {"risk",  "risk [order|position|short|gross|margin|maint|rate|burst <value>]",  "shows the pre-trade risk limits, or changes one"},
+    {"impact",  "impact [off|linear|sqrt] | impact <coeff|depth|halflife> <value>",  "shows how trades move prices, or changes the model"},
+    {"maker",  "maker [on|off] | maker <spread|skew|size|inventory|requote> <value>",  "shows or sets the built-in market maker; spreads are in basis points"},
+    {"agents",  "agents [run <orders> [seed]|stop] | agents <noise|momentum|maker> <count>",  "generates orders from simulated traders on clients 16 and up, which no terminal owns; replies muted"},
+    {"bench",  "bench [synthetic <orders> [seed]|recorded [orders]]",  "times orders from the agents or the journal through order entry; shows the last results"},
+    {"replay",  "replay <pause|resume|step [bars]|speed <x>|max>",  "controls the replay clock; max runs the rest of the data headless"},
+    {"checkpoint",  "checkpoint [save|clear]",  "saves the exchange state now (also saved every bar), or discards it"},
+    {"journal",  "journal [show [n]|replay]",  "lists the newest trade journal records, or rebuilds the exchange from the checkpoint and journal"},
+    {"@<client>",  "@<client> <command>",  "runs any command above for client account <client>; console only, other terminals act for their own client"},
 };
 
 int cmd_options(int argc, const char *argv[]);
@@ -233,7 +251,7 @@ static const command_t commands[] = {
 
 
 int cmd_options(int argc, const char *argv[]) {
-    for (int i = 0; i < 7; i++) {
+    for (int i = 0; i < sizeof(options) / sizeof(options[0]); i++) {
         module.shell_printf("%s\t- %s\n", options[i].name, options[i].description);
     }
     return 0;
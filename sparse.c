@@ -0,0 +1,61 @@
+/* File: sparse.c
+ * --------------
+ * This file implements the sparse table outlined in `sparse.h`.
+ * Row k of the table holds the extreme of every window of length 2^k,
+ * so any range is covered by two (possibly overlapping) windows.
+ */
+#include "sparse.h"
+#include "malloc.h"
+#include "strings.h"
+
+struct sparse {
+    int n, levels;
+    bool is_max;
+    float *table; // levels rows of n entries; row k starts at table + k * n
+};
+
+static int floor_log2(int n) {
+    return 31 - __builtin_clz((unsigned int)n);
+}
+
+static float pick(const sparse_t *st, float a, float b) {
+    if (st->is_max) return a >= b ? a : b;
+    return a <= b ? a : b;
+}
+
+sparse_t *sparse_new(const float vals[], int n, bool is_max) {
+    if (n <= 0) return NULL;
+    sparse_t *st = malloc(sizeof(*st));
+    if (st == NULL) return NULL;
+    st->n = n;
+    st->levels = floor_log2(n) + 1;
+    st->is_max = is_max;
+    st->table = malloc(sizeof(float) * st->levels * n);
+    if (st->table == NULL) {
+        free(st);
+        return NULL;
+    }
+
+    memcpy(st->table, vals, sizeof(float) * n);
+    for (int k = 1; k < st->levels; k++) {
+        const float *prev = st->table + (k - 1) * n;
+        float *row = st->table + k * n;
+        int half = 1 << (k - 1);
+        for (int i = 0; i + (1 << k) <= n; i++) {
+            row[i] = pick(st, prev[i], prev[i + half]);
+        }
+    }
+    return st;
+}
+
+float sparse_query(const sparse_t *st, int lo, int hi) {
+    int k = floor_log2(hi - lo + 1);
+    const float *row = st->table + k * st->n;
+    return pick(st, row[lo], row[hi - (1 << k) + 1]);
+}
+
+void sparse_free(sparse_t *st) {
+    if (st == NULL) return;
+    free(st->table);
+    free(st);
+}
@@ -0,0 +1,49 @@
+#ifndef SPARSE_H
+#define SPARSE_H
+
+/*
+ * Sparse table for constant-time range min/max queries.
+ *
+ * The table is built once over a fixed array of values (O(n log n) time
+ * and space) and then answers "max (or min) of vals[lo..hi]" with two
+ * lookups, independent of the length of the range.
+ */
+
+#include <stdbool.h>
+
+typedef struct sparse sparse_t;
+
+/*
+ * `sparse_new`
+ *
+ * Builds a sparse table over `vals[0..n-1]`. The values are copied, so
+ * `vals` may be discarded after the call.
+ *
+ * @param vals     the values to index
+ * @param n        the number of values
+ * @param is_max   true to answer range maximum queries, false for minimum
+ * @return         the new table, or NULL if out of memory
+ */
+sparse_t *sparse_new(const float vals[], int n, bool is_max);
+
+/*
+ * `sparse_query`
+ *
+ * Returns the max (or min, depending on how the table was built) of
+ * `vals[lo..hi]`, both ends inclusive. Requires 0 <= lo <= hi < n.
+ *
+ * @param st    the table
+ * @param lo    first index of the range
+ * @param hi    last index of the range
+ * @return      the extreme value in the range
+ */
+float sparse_query(const sparse_t *st, int lo, int hi);
+
+/*
+ * `sparse_free`
+ *
+ * Releases the memory held by the table.
+ */
+void sparse_free(sparse_t *st);
+
+#endif
@@ -0,0 +1,224 @@
+/* File: bench_host.c
+ * ------------------
+ * Hosted benchmark of the order entry path: the engine's share of what
+ * `exchange_evaluate` does for a buy or sell (pre-trade risk check,
+ * matching, settling fills and journaling), timed order by order.
+ *
+ * Two workloads:
+ *   synthetic [orders] [seed]   orders from the simulated traders of
+ *                               `agents.h`, journaled as they are placed
+ *   recorded [orders]           the orders in the journal, which holds the
+ *                               last run, replayed oldest first
+ *
+ * Build and run on the host (`make bench_host` runs both workloads):
+ *   gcc -O2 -DHOSTED -DJOURNAL_FILE='"bench.jnl"' -I. src/bench_host.c bench.c agents.c prng.c book.c risk.c journal.c -o bench_host
+ *   ./bench_host synthetic 200000 && ./bench_host recorded
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "agents.h"
+#include "bench.h"
+#include "book.h"
+#include "journal.h"
+#include "risk.h"
+
+#define NSYMBOLS 20
+#define MAX_PRICE 50000         // cents; every book spans twice this
+#define FIRST_CLIENT 1          // agents trade for clients 1 and up, as on the board
+#define INIT_CAPITAL 100000000  // cents ($1M) given to each account, so few orders fail the risk check
+#define ORDERS_PER_BAR 1000     // orders between expiries of good-till-time orders
+#define VOLATILITY 0.0005f      // spread of each step of a symbol's price, as a fraction
+#define TIF_GTC 0               // time in force of journaled orders, numbered as on the board
+#define TIF_IOC 1
+#define TIF_FOK 2
+#define TIF_GTT 3
+
+typedef struct {
+    long cash;
+    int position[NSYMBOLS];     // including shares held for resting sells, as in risk.h
+    int open_buys[NSYMBOLS], open_sells[NSYMBOLS];
+} account_t;
+
+static struct {
+    account_t accounts[BOOK_MAX_ACCOUNTS];
+    risk_limits_t limits;
+    float price[NSYMBOLS];      // random walk the agents trade around
+    prng_t rng;
+    int bar, clock;
+    long fills, rejected;
+} module;
+
+static price_t quote(int symbol, void *aux) {
+    module.price[symbol] *= 1 + VOLATILITY * prng_normal(&module.rng);
+    if (module.price[symbol] < 100) module.price[symbol] = 100;
+    if (module.price[symbol] > MAX_PRICE) module.price[symbol] = MAX_PRICE;
+    return (price_t)module.price[symbol];
+}
+
+static void record(journal_record_t rec) {
+    rec.clock = module.clock;
+    journal_append(&rec);
+}
+
+static void on_fill(const fill_t *fill, void *aux) {
+    int sign = (fill->taker_side == SIDE_BUY ? 1 : -1);
+    long notional = (long)fill->price * fill->qty;
+    account_t *taker = &module.accounts[fill->taker_account];
+    account_t *maker = &module.accounts[fill->maker_account];
+    taker->position[fill->symbol] += sign * fill->qty;
+    taker->cash -= sign * notional;
+    maker->position[fill->symbol] -= sign * fill->qty;
+    maker->cash += sign * notional;
+    if (fill->taker_side == SIDE_BUY) maker->open_sells[fill->symbol] -= fill->qty;
+    else maker->open_buys[fill->symbol] -= fill->qty;
+    module.fills++;
+    record((journal_record_t){
+        .type = JOURNAL_FILL, .side = fill->taker_side, .symbol = fill->symbol, .account = fill->taker_account,
+        .other = fill->maker_account, .id = fill->taker_id, .ref = fill->maker_id, .price = fill->price, .qty = fill->qty,
+        .aux = fill->taker_limit,
+    });
+}
+
+static void on_expired(uint32_t id, const book_order_t *order) {
+    account_t *acct = &module.accounts[order->account];
+    if (order->side == SIDE_BUY) acct->open_buys[order->symbol] -= order->qty;
+    else acct->open_sells[order->symbol] -= order->qty;
+}
+
+static risk_exposure_t exposure(const account_t *acct, int symbol) {
+    risk_exposure_t e = {
+        .position = acct->position[symbol], .open_buys = acct->open_buys[symbol],
+        .open_sells = acct->open_sells[symbol], .equity = acct->cash,
+    };
+    for (int i = 0; i < NSYMBOLS; i++) {
+        long value = (long)acct->position[i] * (price_t)module.price[i];
+        e.equity += value;
+        e.gross += (value < 0 ? -value : value) + (long)acct->open_buys[i] * (price_t)module.price[i];
+    }
+    return e;
+}
+
+static bool place(const agent_order_t *order) {
+    // The order entry path: risk check, match, rest or drop the remainder
+    account_t *acct = &module.accounts[order->client];
+    price_t mark = (price_t)module.price[order->symbol];
+    price_t limit = order->limit;
+    if (limit == BOOK_NO_PRICE) limit = (order->side == SIDE_BUY ? 2 * MAX_PRICE - 1 : 1); // market: take any price
+    risk_exposure_t e = exposure(acct, order->symbol);
+    if (risk_check(&module.limits, &e, order->side, order->qty, order->limit == BOOK_NO_PRICE ? mark : limit) != RISK_OK) {
+        return false;
+    }
+    bool rest = (order->limit != BOOK_NO_PRICE && !order->ioc);
+    book_result_t res;
+    if (!book_submit(order->symbol, order->side, order->qty, limit, order->client, rest, &res)) return false;
+    record((journal_record_t){
+        .type = JOURNAL_ORDER, .side = order->side, .symbol = order->symbol, .account = order->client, .id = res.id,
+        .price = order->limit, .qty = order->qty,
+        .flags = (!rest ? TIF_IOC : order->bars > 0 ? TIF_GTT : TIF_GTC), .aux = (order->bars > 0 ? module.bar + order->bars : BOOK_NO_EXPIRY),
+    });
+    if (res.rested) {
+        int left = order->qty - res.filled;
+        if (order->side == SIDE_BUY) acct->open_buys[order->symbol] += left;
+        else acct->open_sells[order->symbol] += left;
+        if (order->bars > 0) book_set_expiry(res.id, module.bar + order->bars);
+    }
+    return true;
+}
+
+// Recorded workload
+
+static struct {
+    agent_order_t *orders;
+    int n, capacity;
+} recorded;
+
+static void collect(uint32_t seq, const journal_record_t *rec, void *aux) {
+    if (rec->type != JOURNAL_ORDER || rec->symbol >= NSYMBOLS || rec->account < 0 || rec->account >= BOOK_MAX_ACCOUNTS) return;
+    if (recorded.n == recorded.capacity) {
+        recorded.capacity = (recorded.capacity > 0 ? 2 * recorded.capacity : 4096);
+        recorded.orders = realloc(recorded.orders, recorded.capacity * sizeof(agent_order_t));
+    }
+    recorded.orders[recorded.n++] = (agent_order_t){
+        .client = rec->account, .side = rec->side, .symbol = rec->symbol, .qty = rec->qty, .limit = rec->price,
+        .ioc = (rec->flags == TIF_IOC || rec->flags == TIF_FOK), .bars = (rec->flags == TIF_GTT ? 1 : 0),
+    };
+}
+
+static double now_usecs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [synthetic [orders [seed]] | recorded [orders]]\n", name);
+    exit(1);
+}
+
+int main(int argc, const char *argv[]) {
+    const char *workload = (argc > 1 ? argv[1] : "synthetic");
+    long norders = (argc > 2 ? atol(argv[2]) : 0);
+    uint64_t seed = (argc > 3 ? strtoull(argv[3], NULL, 10) : 107);
+    bool synthetic = (strcmp(workload, "synthetic") == 0);
+    if ((!synthetic && strcmp(workload, "recorded") != 0) || norders < 0 || argc > (synthetic ? 4 : 3)) usage(argv[0]);
+
+    // the same defaults as the board's accounts
+    module.limits = (risk_limits_t){
+        .max_order_qty = 10000, .max_position = 50000, .max_short = 10000, .max_gross = 100000000,
+        .initial_margin_pct = 50, .maint_margin_pct = 25,
+    };
+    for (int k = 0; k < BOOK_MAX_ACCOUNTS; k++) {
+        module.accounts[k].cash = INIT_CAPITAL;
+    }
+    prng_seed(&module.rng, seed);
+    price_t max_price[NSYMBOLS];
+    for (int i = 0; i < NSYMBOLS; i++) {
+        max_price[i] = MAX_PRICE;
+        module.price[i] = 2000 + prng_range(&module.rng, 30000); // $20 to $320
+    }
+    if (!book_init(NSYMBOLS, max_price, on_fill, NULL)) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    agents_t gen;
+    journal_init();
+    if (synthetic) {
+        if (norders == 0) norders = 200000;
+        agents_init(&gen, seed, NSYMBOLS, quote, NULL);
+        agents_populate(&gen, (int[AGENT_KINDS]){ [AGENT_NOISE] = 6, [AGENT_MOMENTUM] = 3, [AGENT_MAKER] = 5 }, FIRST_CLIENT);
+    } else {
+        // copied out first: the replayed orders are journaled in turn
+        journal_replay(0, collect, NULL);
+        if (recorded.n == 0) {
+            fprintf(stderr, "%s has no orders; run the synthetic workload first\n", JOURNAL_FILE);
+            return 1;
+        }
+        if (norders == 0) norders = recorded.n;
+    }
+    journal_reset(0); // the journal records this run only
+
+    bench_t *cycles = malloc(sizeof(bench_t));
+    bench_reset(cycles);
+    double start = now_usecs();
+    for (long k = 0; k < norders; k++) {
+        agent_order_t order;
+        if (synthetic) agents_next(&gen, &order);
+        else order = recorded.orders[k % recorded.n];
+        uint64_t before = bench_cycles();
+        if (!place(&order)) module.rejected++;
+        bench_record(cycles, bench_cycles() - before);
+        if (++module.clock % ORDERS_PER_BAR == 0) book_expire(++module.bar, on_expired);
+    }
+    double usecs = now_usecs() - start;
+    journal_sync();
+
+    char buf[160];
+    printf("bench_host: %s, %ld orders in %.0f ms (%.0f per second); %ld rejected, %ld fills\n", workload, norders,
+           usecs / 1000, usecs > 0 ? norders * 1e6 / usecs : 0, module.rejected, module.fills);
+    bench_format(cycles, buf, sizeof(buf));
+    printf("%s\n", buf);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/* File: test_book.c
+ * -----------------
+ * Hosted test of the matching engine in `book.h`: an incoming order
+ * crossing several levels and partially filling a resting one, price-time
+ * priority within a level, and a call auction's clearing price and the
+ * volume it leaves on the book.
+ *
+ * Build and run on the host (`make test_book` does both):
+ *   gcc -O2 -DHOSTED -I. src/test_book.c book.c -o test_book && ./test_book
+ */
+#include <assert.h>
+#include <stdio.h>
+#include "book.h"
+
+#define MAX_FILLS 16
+
+static struct {
+    fill_t fills[MAX_FILLS];
+    int n;
+} seen;
+
+static void on_fill(const fill_t *fill, void *aux) {
+    assert(seen.n < MAX_FILLS);
+    seen.fills[seen.n++] = *fill;
+}
+
+static void rest(int symbol, side_t side, int qty, price_t price, int account, uint32_t *id) {
+    // Submits an order that must rest in full
+    book_result_t res;
+    assert(book_submit(symbol, side, qty, price, account, true, &res));
+    assert(res.filled == 0 && res.rested);
+    if (id) *id = res.id;
+}
+
+static void test_crossing(void) {
+    book_order_t o;
+    uint32_t a1, a2, a3;
+    rest(0, SIDE_SELL, 100, 1000, 1, &a1);
+    rest(0, SIDE_SELL, 50, 1010, 2, &a2);
+    rest(0, SIDE_SELL, 40, 1010, 3, &a3); // behind a2 at the same price
+    assert(book_best(0, SIDE_SELL) == 1000 && book_best(0, SIDE_BUY) == BOOK_NO_PRICE);
+    assert(book_available(0, SIDE_BUY, 500, 1010) == 190);
+
+    // takes the whole of the best level, then part of the oldest order at the next
+    book_result_t res;
+    seen.n = 0;
+    assert(book_submit(0, SIDE_BUY, 120, 1010, 4, true, &res));
+    assert(res.filled == 120 && !res.rested);
+    assert(seen.n == 2);
+    assert(seen.fills[0].maker_id == a1 && seen.fills[0].price == 1000 && seen.fills[0].qty == 100);
+    assert(seen.fills[1].maker_id == a2 && seen.fills[1].price == 1010 && seen.fills[1].qty == 20);
+    assert(seen.fills[1].taker_id == res.id && seen.fills[1].taker_account == 4 && seen.fills[1].taker_limit == 1010);
+    assert(!book_order(a1, &o)); // filled: its id is stale
+    assert(book_order(a2, &o) && o.qty == 30 && o.account == 2);
+    assert(book_order(a3, &o) && o.qty == 40);
+
+    // a partial fill rests the remainder at its limit
+    seen.n = 0;
+    assert(book_submit(0, SIDE_BUY, 50, 1020, 5, true, &res));
+    assert(res.filled == 50 && !res.rested && seen.n == 2);
+    assert(seen.fills[0].maker_id == a2 && seen.fills[0].qty == 30);
+    assert(seen.fills[1].maker_id == a3 && seen.fills[1].qty == 20 && seen.fills[1].price == 1010);
+    assert(book_order(a3, &o) && o.qty == 20);
+    seen.n = 0;
+    assert(book_submit(0, SIDE_BUY, 50, 1020, 5, true, &res));
+    assert(res.filled == 20 && res.rested && seen.n == 1);
+    assert(book_order(res.id, &o) && o.qty == 30 && o.price == 1020 && o.side == SIDE_BUY);
+    assert(book_best(0, SIDE_BUY) == 1020 && book_best(0, SIDE_SELL) == BOOK_NO_PRICE);
+
+    // an order that may not rest drops what does not fill
+    seen.n = 0;
+    assert(book_submit(0, SIDE_SELL, 100, 1020, 6, false, &res));
+    assert(res.filled == 30 && !res.rested && seen.n == 1);
+    assert(book_best(0, SIDE_BUY) == BOOK_NO_PRICE && book_open_count(5) == 0);
+}
+
+static void test_uncross(void) {
+    uint32_t b1, b2, a1, a2;
+    book_set_call(true);
+    rest(1, SIDE_BUY, 100, 1010, 1, &b1);
+    rest(1, SIDE_BUY, 50, 1005, 2, &b2);
+    rest(1, SIDE_SELL, 80, 1000, 3, &a1);
+    rest(1, SIDE_SELL, 60, 1008, 4, &a2);
+    assert(book_best(1, SIDE_BUY) == 1010 && book_best(1, SIDE_SELL) == 1000); // left crossed
+
+    // 100 shares clear at 1008 and at 1010 with the same imbalance; 1008 is nearer the reference
+    price_t price;
+    seen.n = 0;
+    assert(book_uncross(1, 1000, &price) == 100);
+    assert(price == 1008);
+    int volume = 0;
+    for (int k = 0; k < seen.n; k++) {
+        assert(seen.fills[k].price == 1008 && seen.fills[k].taker_side == SIDE_BUY);
+        volume += seen.fills[k].qty;
+    }
+    assert(volume == 100);
+    assert(seen.fills[0].taker_id == b1 && seen.fills[0].maker_id == a1 && seen.fills[0].qty == 80);
+    assert(seen.fills[1].taker_id == b1 && seen.fills[1].maker_id == a2 && seen.fills[1].qty == 20);
+
+    // what did not clear stays, no longer crossed
+    book_order_t o;
+    assert(!book_order(b1, &o) && !book_order(a1, &o));
+    assert(book_order(b2, &o) && o.qty == 50);
+    assert(book_order(a2, &o) && o.qty == 40);
+    assert(book_best(1, SIDE_BUY) == 1005 && book_best(1, SIDE_SELL) == 1008);
+    assert(book_uncross(1, 1000, &price) == 0);
+    book_set_call(false);
+}
+
+int main(void) {
+    price_t max_price[] = { 5000, 5000 }; // one-cent ticks
+    assert(book_init(2, max_price, on_fill, NULL));
+    assert(book_tick(0) == 1);
+    test_crossing();
+    test_uncross();
+    printf("test_book: crossing, partial fills and the call auction passed\n");
+    return 0;
+}
@@ -0,0 +1,75 @@
+/* File: test_lots.c
+ * -----------------
+ * Hosted test of the cost-basis lots in `lots.h`: trades that cover a
+ * short or sell a long through zero, exact cents on partial closes, and
+ * a full ring merging new trades into its newest lot.
+ *
+ * Build and run on the host (`make test_lots` does both):
+ *   gcc -O2 -DHOSTED -I. src/test_lots.c lots.c -o test_lots && ./test_lots
+ */
+#include <assert.h>
+#include <stdio.h>
+#include "lots.h"
+
+static void test_through_zero(void) {
+    lots_t lots = { 0 };
+    assert(lots_sell(&lots, 100, 1000, false) == 0); // opens a short for $1000 of proceeds
+    assert(lots.qty == -100 && lots.cost == -100000 && lots.n == 1);
+
+    // covers the whole short at a profit, then opens a long with the rest
+    assert(lots_buy(&lots, 150, 900, false) == 100 * (1000 - 900));
+    assert(lots.qty == 50 && lots.cost == 50 * 900 && lots.n == 1);
+    assert(lots.lot[lots.head].qty == 50);
+
+    // and back through zero the other way, at a loss
+    assert(lots_sell(&lots, 80, 850, false) == 50 * (850 - 900));
+    assert(lots.qty == -30 && lots.cost == -30 * 850 && lots.n == 1);
+    assert(lots_buy(&lots, 30, 850, false) == 0);
+    assert(lots.qty == 0 && lots.cost == 0 && lots.n == 0);
+}
+
+static void test_partial_close(void) {
+    lots_t lots = { 0 };
+    lots_buy(&lots, 1, 333, true);
+    lots_buy(&lots, 2, 334, true); // one lot of 3 shares for $10.01: not a whole number of cents each
+    lots_buy(&lots, 1, 1, false);
+    assert(lots.n == 2 && lots.lot[lots.head].cost == 1001 && lots.cost == 1002);
+    assert(lots_sell(&lots, 1, 400, false) == 400 - 333); // takes 1001 / 3 rounded toward zero
+    assert(lots.lot[lots.head].qty == 2 && lots.lot[lots.head].cost == 668 && lots.cost == 669);
+    assert(lots_sell(&lots, 2, 400, false) == 800 - 668); // the remainder goes with the rest
+    assert(lots.qty == 1 && lots.cost == 1 && lots.n == 1);
+}
+
+static void test_full_ring(void) {
+    lots_t lots = { 0 };
+    lots_sell(&lots, 5, 50, false);
+    lots_buy(&lots, 5, 50, false); // leaves the ring empty with its head moved
+    int64_t cost = 0;
+    for (int k = 0; k < LOTS_MAX + 2; k++) {
+        lots_buy(&lots, 1, 100 + k, false);
+        cost += 100 + k;
+    }
+    // the last two buys found the ring full and merged into the newest lot
+    assert(lots.n == LOTS_MAX && lots.qty == LOTS_MAX + 2 && lots.cost == cost);
+    const lot_t *newest = &lots.lot[(lots.head + lots.n - 1) % LOTS_MAX];
+    assert(newest->qty == 3 && newest->cost == 107 + 108 + 109);
+
+    // sells still close the oldest lots first, whole lots at their own cost
+    assert(lots_sell(&lots, 2, 200, false) == 400 - 100 - 101);
+    assert(lots.n == LOTS_MAX - 2);
+    assert(lots_sell(&lots, LOTS_MAX - 3, 200, false) == 200 * (LOTS_MAX - 3) - (102 + 103 + 104 + 105 + 106));
+    assert(lots.n == 1 && lots.qty == 3 && lots.cost == 107 + 108 + 109);
+
+    // the average-cost merge keeps the exact total
+    lots_buy(&lots, 1, 1, false);
+    lots_merge(&lots);
+    assert(lots.n == 1 && lots.lot[lots.head].qty == 4 && lots.lot[lots.head].cost == 107 + 108 + 109 + 1);
+}
+
+int main(void) {
+    test_through_zero();
+    test_partial_close();
+    test_full_ring();
+    printf("test_lots: covering through zero, partial closes and the full ring passed\n");
+    return 0;
+}
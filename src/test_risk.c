@@ -0,0 +1,61 @@
+/* File: test_risk.c
+ * -----------------
+ * Hosted test of the pre-trade checks in `risk.h`: orders that only
+ * reduce a position pass even when the account is over its limits, and
+ * only the part of an order that opens a position is checked.
+ *
+ * Build and run on the host (`make test_risk` does both):
+ *   gcc -O2 -DHOSTED -I. src/test_risk.c risk.c -o test_risk && ./test_risk
+ */
+#include <assert.h>
+#include <stdio.h>
+#include "risk.h"
+
+static const risk_limits_t limits = {
+    .max_order_qty = 1000, .max_position = 500, .max_short = 100, .max_gross = 1000000,
+    .initial_margin_pct = 50, .maint_margin_pct = 25,
+};
+
+static void test_reducing(void) {
+    // long past every limit: over the position and gross limits with no equity left
+    risk_exposure_t e = { .position = 800, .gross = 2000000, .equity = 0 };
+    assert(risk_check(&limits, &e, SIDE_BUY, 1, 1000) == RISK_POSITION);
+    assert(risk_check(&limits, &e, SIDE_SELL, 800, 1000) == RISK_OK);
+    assert(risk_check(&limits, &e, SIDE_SELL, 300, 1000) == RISK_OK);
+
+    // resting sells already close part of it: only what is left reduces the position
+    e.open_sells = 750;
+    assert(risk_check(&limits, &e, SIDE_SELL, 50, 1000) == RISK_OK);
+    e.gross = 0;
+    e.equity = 1000000;
+    assert(risk_check(&limits, &e, SIDE_SELL, 200, 1000) == RISK_BORROW); // 150 short is past the borrow limit
+    assert(risk_check(&limits, &e, SIDE_SELL, 150, 1000) == RISK_OK);     // 100 short is not
+
+    // covering a short is a buy that reduces
+    risk_exposure_t s = { .position = -600, .gross = 5000000, .equity = -10000 };
+    assert(risk_check(&limits, &s, SIDE_BUY, 600, 5000) == RISK_OK);
+    assert(risk_check(&limits, &s, SIDE_BUY, 601, 5000) != RISK_OK); // the last share opens a long
+
+    // the order size limit applies either way
+    assert(risk_check(&limits, &e, SIDE_SELL, 1001, 1000) == RISK_ORDER_SIZE);
+}
+
+static void test_basket(void) {
+    // legs that only reduce pass the portfolio checks too
+    risk_exposure_t account = { .gross = 2000000, .equity = 0 };
+    risk_leg_t legs[] = {
+        { .position = 800, .side = SIDE_SELL, .qty = 800, .price = 1000 },
+        { .position = -300, .side = SIDE_BUY, .qty = 200, .price = 2000 },
+    };
+    int failed;
+    assert(risk_check_basket(&limits, &account, legs, 2, &failed) == RISK_OK && failed == -1);
+    legs[1].qty = 400; // opens 100 long with no equity to pay for it
+    assert(risk_check_basket(&limits, &account, legs, 2, &failed) != RISK_OK);
+}
+
+int main(void) {
+    test_reducing();
+    test_basket();
+    printf("test_risk: position-reducing orders passed the limits\n");
+    return 0;
+}
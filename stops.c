@@ -0,0 +1,168 @@
+/* File: stops.c
+ * -------------
+ * This file implements the stop order trigger lists outlined in `stops.h`
+ */
+#include "stops.h"
+#include "malloc.h"
+
+typedef struct {
+    stop_t *items;  // sorted by `key`, next to trigger last
+    int n;
+} list_t;
+
+static struct {
+    int nsymbols;
+    list_t lists[BOOK_MAX_SYMBOLS][2]; // indexed by symbol, side_t
+    uint32_t next_id;
+} module;
+
+static long key(side_t side, price_t price) {
+    // Larger keys trigger first: the lowest buy trigger, the highest sell trigger
+    return side == SIDE_BUY ? -(long)price : (long)price;
+}
+
+bool stops_init(int nsymbols) {
+    module.nsymbols = nsymbols;
+    module.next_id = 0;
+    for (int s = 0; s < nsymbols; s++) {
+        for (int side = 0; side < 2; side++) {
+            list_t *list = &module.lists[s][side];
+            list->items = malloc(sizeof(stop_t) * STOPS_MAX);
+            if (list->items == NULL) return false;
+            list->n = 0;
+        }
+    }
+    return true;
+}
+
+static bool insert(const stop_t *stop) {
+    list_t *list = &module.lists[stop->symbol][stop->side];
+    if (list->n == STOPS_MAX) return false;
+    // insert before any equal triggers so older stops stay nearer the end
+    long k = key(stop->side, stop->trigger);
+    int lo = 0, hi = list->n;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (key(stop->side, list->items[mid].trigger) < k) lo = mid + 1;
+        else hi = mid;
+    }
+    for (int j = list->n; j > lo; j--) {
+        list->items[j] = list->items[j - 1];
+    }
+    list->items[lo] = *stop;
+    list->n++;
+    return true;
+}
+
+bool stops_add(stop_t *stop) {
+    stop->id = module.next_id;
+    if (!insert(stop)) return false;
+    module.next_id++;
+    return true;
+}
+
+bool stops_restore(const stop_t *stop) {
+    if (stop->symbol < 0 || stop->symbol >= module.nsymbols || (stop->side != SIDE_BUY && stop->side != SIDE_SELL)) return false;
+    if (!insert(stop)) return false;
+    if (stop->id >= module.next_id) module.next_id = stop->id + 1;
+    return true;
+}
+
+int stops_export(stop_t out[], int max) {
+    // each list from its first entry, so appending them in turn rebuilds it
+    int n = 0;
+    for (int s = 0; s < module.nsymbols; s++) {
+        for (int side = 0; side < 2; side++) {
+            const list_t *list = &module.lists[s][side];
+            for (int k = 0; k < list->n && n < max; k++) {
+                out[n++] = list->items[k];
+            }
+        }
+    }
+    return n;
+}
+
+int stops_load(const stop_t stops[], int n, uint32_t next_id) {
+    for (int s = 0; s < module.nsymbols; s++) {
+        module.lists[s][SIDE_BUY].n = module.lists[s][SIDE_SELL].n = 0;
+    }
+    module.next_id = next_id;
+    int loaded = 0;
+    for (int k = 0; k < n; k++) {
+        const stop_t *stop = &stops[k];
+        if (stop->symbol < 0 || stop->symbol >= module.nsymbols || (stop->side != SIDE_BUY && stop->side != SIDE_SELL)) continue;
+        list_t *list = &module.lists[stop->symbol][stop->side];
+        if (list->n == STOPS_MAX) continue;
+        list->items[list->n++] = *stop;
+        if (stop->id >= module.next_id) module.next_id = stop->id + 1;
+        loaded++;
+    }
+    return loaded;
+}
+
+int stops_count(void) {
+    int n = 0;
+    for (int s = 0; s < module.nsymbols; s++) {
+        n += module.lists[s][SIDE_BUY].n + module.lists[s][SIDE_SELL].n;
+    }
+    return n;
+}
+
+uint32_t stops_next_id(void) {
+    return module.next_id;
+}
+
+int stops_trigger(int symbol, price_t price, stop_fn_t fire) {
+    int n = 0;
+    for (int side = 0; side < 2; side++) {
+        list_t *list = &module.lists[symbol][side];
+        while (list->n > 0 && key(side, list->items[list->n - 1].trigger) >= key(side, price)) {
+            stop_t stop = list->items[--list->n]; // copy: `fire` may add stops
+            fire(&stop);
+            n++;
+        }
+    }
+    return n;
+}
+
+static void remove_at(list_t *list, int k) {
+    list->n--;
+    for (; k < list->n; k++) {
+        list->items[k] = list->items[k + 1];
+    }
+}
+
+bool stops_cancel(uint32_t id, int account, stop_t *out) {
+    for (int s = 0; s < module.nsymbols; s++) {
+        for (int side = 0; side < 2; side++) {
+            list_t *list = &module.lists[s][side];
+            for (int k = 0; k < list->n; k++) {
+                if (list->items[k].id == id) {
+                    if (list->items[k].account != account) return false;
+                    if (out) *out = list->items[k];
+                    remove_at(list, k);
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+int stops_cancel_all(int account, stop_fn_t on_cancel) {
+    int n = 0;
+    for (int s = 0; s < module.nsymbols; s++) {
+        for (int side = 0; side < 2; side++) {
+            list_t *list = &module.lists[s][side];
+            for (int k = list->n - 1; k >= 0; k--) {
+                if (list->items[k].account == account) {
+                    stop_t stop = list->items[k];
+                    remove_at(list, k);
+                    if (on_cancel) on_cancel(&stop);
+                    n++;
+                }
+            }
+        }
+    }
+    return n;
+}
@@ -0,0 +1,125 @@
+#ifndef STOPS_H
+#define STOPS_H
+
+/*
+ * Stop order trigger lists.
+ *
+ * A stop order waits off the book until the price reaches its trigger:
+ * buy stops at or above the trigger, sell stops at or below. Each symbol
+ * keeps one array per side, sorted so the next stop to trigger is at the
+ * end. Checking a price is then a single compare against that last entry,
+ * so resting stops cost nothing on ticks that don't reach them.
+ * Triggering pops entries off the end. Adding one is a binary search and
+ * a shift.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "book.h"
+
+#define STOPS_MAX 1024 // resting stops per side per symbol
+
+typedef struct {
+    uint32_t id;
+    int symbol;
+    side_t side;
+    price_t trigger;
+    price_t limit;  // limit of the order placed when triggered, or BOOK_NO_PRICE for a market order
+    int qty;
+    int account;
+} stop_t;
+
+typedef void (*stop_fn_t)(const stop_t *stop);
+
+/*
+ * `stops_init`: Required initialization for module
+ *
+ * @return   false if out of memory
+ */
+bool stops_init(int nsymbols);
+
+/*
+ * `stops_add`
+ *
+ * Adds a stop, assigning its `id`. Stops with equal triggers fire in the
+ * order they were added.
+ *
+ * @return   false if the symbol's list for that side is full
+ */
+bool stops_add(stop_t *stop);
+
+/*
+ * `stops_restore`
+ *
+ * Adds a stop under the `id` it already has, as journal replay does;
+ * stops added later are numbered after it.
+ *
+ * @return   false if the symbol's list for that side is full
+ */
+bool stops_restore(const stop_t *stop);
+
+/*
+ * `stops_export`
+ *
+ * Copies up to `max` resting stops to `out`, list by list in the order
+ * `stops_load` needs to rebuild the lists exactly.
+ *
+ * @return   the number of stops written
+ */
+int stops_export(stop_t out[], int max);
+
+/*
+ * `stops_load`
+ *
+ * Replaces every resting stop with `stops[0..n-1]` as written by
+ * `stops_export`, and numbers new stops from `next_id` (or past the
+ * largest id loaded).
+ *
+ * @return   the number of stops loaded
+ */
+int stops_load(const stop_t stops[], int n, uint32_t next_id);
+
+/*
+ * `stops_count`
+ *
+ * @return   the number of resting stops
+ */
+int stops_count(void);
+
+/*
+ * `stops_next_id`
+ *
+ * @return   the id the next stop added will get
+ */
+uint32_t stops_next_id(void);
+
+/*
+ * `stops_trigger`
+ *
+ * Removes every stop of `symbol` that `price` reaches and passes each to
+ * `fire`, in trigger order. `fire` may add new stops.
+ *
+ * @return   the number of stops triggered
+ */
+int stops_trigger(int symbol, price_t price, stop_fn_t fire);
+
+/*
+ * `stops_cancel`
+ *
+ * Removes stop `id` if it belongs to `account`. Searches the lists linearly.
+ *
+ * @param out   if not NULL, receives the stop as it was
+ * @return      false if `id` is not a resting stop of `account`
+ */
+bool stops_cancel(uint32_t id, int account, stop_t *out);
+
+/*
+ * `stops_cancel_all`
+ *
+ * Removes every stop of `account`, passing each to `on_cancel` (if not NULL).
+ *
+ * @return   the number of stops removed
+ */
+int stops_cancel_all(int account, stop_fn_t on_cancel);
+
+#endif
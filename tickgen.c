@@ -0,0 +1,52 @@
+/* File: tickgen.c
+ * ---------------
+ * This file implements the intraday path generator outlined in `tickgen.h`
+ */
+#include <stdbool.h>
+#include "tickgen.h"
+#include "mathlib.h"
+
+void tickgen_start(tickgen_t *g, uint64_t seed, float open, float high, float low, float close, int n_steps) {
+    prng_seed(&g->rng, seed);
+    g->low = low;
+    g->high = high;
+    g->n_steps = n_steps;
+    g->step = 0;
+    g->leg = 0;
+    g->price = g->run_high = g->run_low = open;
+    g->sigma = (high - low) / (2 * sqrt(n_steps));
+
+    // Up bars usually dip first and down bars usually rally first
+    float p_low_first = (close >= open ? 0.7 : 0.3);
+    bool low_first = prng_uniform(&g->rng) < p_low_first;
+    g->target[0] = (low_first ? low : high);
+    g->target[1] = (low_first ? high : low);
+    g->target[2] = close;
+
+    // Leg boundaries: 0 < pivot[0] < pivot[1] < n_steps
+    g->pivot[0] = 1 + prng_range(&g->rng, n_steps - 2);
+    g->pivot[1] = g->pivot[0] + 1 + prng_range(&g->rng, n_steps - g->pivot[0] - 1);
+    g->pivot[2] = n_steps;
+}
+
+float tickgen_next(tickgen_t *g) {
+    if (g->step >= g->n_steps) return g->price;
+
+    g->step++;
+    int remaining = g->pivot[g->leg] - g->step + 1; // steps left in this leg, including this one
+    float target = g->target[g->leg];
+    if (remaining <= 1) {
+        g->price = target;
+        g->leg++;
+    } else {
+        // Brownian bridge step: drift toward the target, shrink noise near it
+        float z = prng_normal(&g->rng);
+        g->price += (target - g->price) / remaining + g->sigma * sqrt((float)(remaining - 1) / remaining) * z;
+        if (g->price > g->high) g->price = g->high;
+        if (g->price < g->low) g->price = g->low;
+    }
+
+    if (g->price > g->run_high) g->run_high = g->price;
+    if (g->price < g->run_low) g->run_low = g->price;
+    return g->price;
+}
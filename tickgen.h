@@ -0,0 +1,48 @@
+#ifndef TICKGEN_H
+#define TICKGEN_H
+
+/*
+ * Intraday tick synthesis between OHLC bars.
+ *
+ * `tickgen_t` walks a deterministic price path through one bar: it starts
+ * at the open, touches the high and the low (in an order chosen by the
+ * seed), and ends exactly at the close, never leaving [low, high]. Each
+ * leg is a Brownian bridge, so the path looks like a random walk but is
+ * pinned to the bar. Ticks are generated on demand one step at a time;
+ * nothing is stored, and the same seed always reproduces the same path.
+ */
+
+#include "prng.h"
+
+typedef struct {
+    prng_t rng;
+    float low, high;
+    float sigma;          // per-step volatility of the walk
+    int n_steps, step;    // the path ends at the close after `n_steps` steps
+    int pivot[3];         // step at which each leg ends (last is `n_steps`)
+    float target[3];      // price at the end of each leg
+    int leg;
+    float price;          // current price
+    float run_high, run_low; // extremes of the path so far
+} tickgen_t;
+
+/*
+ * `tickgen_start`
+ *
+ * Begins a new path through the bar (open, high, low, close).
+ *
+ * @param g         the generator
+ * @param seed      seed for the path; the same seed yields the same path
+ * @param n_steps   number of steps from open to close (at least 3)
+ */
+void tickgen_start(tickgen_t *g, uint64_t seed, float open, float high, float low, float close, int n_steps);
+
+/*
+ * `tickgen_next`
+ *
+ * Advances the path by one step and returns the new price. After
+ * `n_steps` calls the price equals the close and stays there.
+ */
+float tickgen_next(tickgen_t *g);
+
+#endif